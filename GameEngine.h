@@ -17,7 +17,43 @@
 #include <array>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <bitset>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cmath>
+#include <type_traits>
+#include <new>
+#include <cstring>
+#include <cstddef>
+#include <cstdlib>
+#include <cassert>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <functional>
+#include <exception>
+
+// CORUTINELE (COMPORTAMENTELE AI) SUNT DISPONIBILE DOAR DACA SE COMPILEAZA CU C++20
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+
+#if defined(__cpp_lib_coroutine)
+#define GAMEENGINE_COROUTINES
+#endif
+#endif
+
+// CONTOARELE HARDWARE (PerformanceCounters) FOLOSESC perf_event_open, DECI EXISTA DOAR PE LINUX. GAMEENGINE_NO_PERFORMANCE_COUNTERS LE SCOATE DE TOT
+#if defined(__linux__) && !defined(GAMEENGINE_NO_PERFORMANCE_COUNTERS)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <cerrno>
+
+#define GAMEENGINE_PERFORMANCE_COUNTERS
+#endif
 
 // DECLARAREA TUTUROR CLASELOR SI STRUCTURILOR
 
@@ -29,22 +65,35 @@ class WindowManager;
 class TimeManager;
 class UserInputManager;
 class EntityManager;
+class EntityPool;
 class AssetManager;
 class MovementManager;
 class CollisionManager;
 class AnimationManager;
 class ArtificialIntelligenceManager;
+class FlowFieldManager;
+class ReplayManager;
+class SnapshotManager;
+class RenderQueue;
+class CameraManager;
+class SpatialOrderManager;
+class ComponentStorageManager;
+#ifdef GAMEENGINE_COROUTINES
+class BehaviorFramePool;
+#endif
+
+// LUMEA DE SIMULARE
+class World;
 
 // CLASA SINGLETON PLAYER
 class Player;
 
 // RENDERER2D
 class Renderer2D;
+class RenderBackend;
 
 // ENTITATE
 class Entity;
-// COMPONENTA (CLASA VIRTUALA, TOATE COMPONENTELE CE VOR FI FOLOSITE SE MOSTENESC DIN ACEASTA)
-class Component;
 
 // CE TIPURI DE ENTITATI EXISTA
 enum class EntityType
@@ -86,9 +135,29 @@ namespace AI
 	const double EPSILON_Y_AGGRESIVE = 350.0; // ANALOG PE OY
 }
 
+// STAREA TASTELOR FOLOSITE DE ENGINE, CA MASCA DE BITI (ASA SE SI INREGISTREAZA IN FISIERELE DE REPLAY)
+
+namespace Input
+{
+	const unsigned char KEY_ESCAPE = 1 << 0;
+	const unsigned char KEY_RIGHT = 1 << 1; // D
+	const unsigned char KEY_LEFT = 1 << 2; // A
+	const unsigned char KEY_JUMP = 1 << 3; // SPACE
+}
+
 // STRUCTURA UNEI TEXTURI
 struct Texture;
 
+// PRECIZIA NUMERELOR DIN COMPONENTE SI DIN SISTEMELE DE MISCARE SI COLIZIUNE
+// IMPLICIT double. DACA GAMEENGINE_SINGLE_PRECISION E DEFINIT INAINTE DE INCLUDERE, float (JUMATATE DIN MEMORIE SI DUBLU PE REGISTRELE SIMD)
+// LA NIVELE MARI, CU float, ORIGINEA LUMII TREBUIE MUTATA PERIODIC LANGA JUCATOR (VEZI GameEngine::RebaseOrigin)
+
+#ifdef GAMEENGINE_SINGLE_PRECISION
+using Scalar = float;
+#else
+using Scalar = double;
+#endif
+
 // COMPONENT SYSTEM
 
 const int MAX_ENTITIES = 2048;
@@ -97,22 +166,9 @@ const int MAX_COMPONENTS = 64;
 using ComponentTypeID = int;
 
 using ComponentBitset = std::bitset<MAX_COMPONENTS>;
-using ComponentList = std::array<Component*, MAX_COMPONENTS>;
-
-inline ComponentTypeID InternalGetComponentTypeID()
-{
-	static ComponentTypeID lastID = 0;
-	return lastID++;
-}
-
-template<typename T>
-inline ComponentTypeID GetComponentTypeID()
-{
-	static const ComponentTypeID typeID = InternalGetComponentTypeID();
-	return typeID;
-}
+using ComponentIndexList = std::array<int, MAX_COMPONENTS>; // POZITIA FIECAREI COMPONENTE IN STOCAREA TIPULUI EI
 
-// CLASELE COMPONENTELOR CE SE MOSTENESC DIN COMPONENTA DE BAZA, VIRTUALA
+// CLASELE COMPONENTELOR (FARA CLASA DE BAZA, TINUTE PRIN VALOARE IN ComponentStorage)
 // 2D
 class Position2D;
 class Hitbox2D;
@@ -125,1746 +181,9591 @@ class Gravity2D;
 class Animation2D;
 class MovementSpeed2D;
 class ArtificialIntelligence2D;
+class Parallax2D;
 
 // 3D
 
-// MAI JOS, TOATE DECLARILE NU SUNT IN ORDINEA DE MAI SUS, DIN CAUZA CA UNELE DEPIND DE ALTELE
+// LISTA COMPONENTELOR ENGINE-ULUI. ID-UL UNEI COMPONENTE ESTE POZITIA EI IN LISTA, CUNOSCUT LA COMPILARE SI ACELASI LA FIECARE RULARE
+// (SE POATE FOLOSI LA SERIALIZARE). COMPONENTELE NOI SE ADAUGA DOAR LA SFARSIT, CA ID-URILE CELOR VECHI SA NU SE SCHIMBE
 
-// CLASA WINDOW MANAGER
+template<typename... Types>
+struct ComponentTypeList
+{
+	static constexpr int size = sizeof...(Types);
+};
 
-class WindowManager
+using EngineComponents = ComponentTypeList<Position2D, Hitbox2D, Texture2D, TextureBox2D, Render2D, Speed2D, Acceleration2D, Gravity2D, Animation2D, MovementSpeed2D, ArtificialIntelligence2D, Parallax2D>;
+
+static_assert(EngineComponents::size <= MAX_COMPONENTS, "THERE ARE MORE ENGINE COMPONENTS THAN MAX_COMPONENTS");
+static_assert(MAX_COMPONENTS <= 64, "COMPONENT SIGNATURES ARE STORED ON 64 BITS");
+
+// POZITIA LUI T IN LISTA SAU -1 DACA NU E ACOLO
+template<typename T, typename List>
+struct ComponentIndex;
+
+template<typename T>
+struct ComponentIndex<T, ComponentTypeList<>>
 {
-public:
+	static constexpr int value = -1;
+};
 
-	static WindowManager* Get()
+template<typename T, typename First, typename... Rest>
+struct ComponentIndex<T, ComponentTypeList<First, Rest...>>
+{
+	static constexpr int next = ComponentIndex<T, ComponentTypeList<Rest...>>::value;
+	static constexpr int value = std::is_same<T, First>::value ? 0 : (next == -1 ? -1 : next + 1);
+};
+
+template<typename T>
+constexpr bool IsEngineComponent()
+{
+	return ComponentIndex<T, EngineComponents>::value != -1;
+}
+
+// COMPONENTELE DEFINITE IN AFARA ENGINE-ULUI PRIMESC ID-URI LA RULARE, DUPA CELE DIN LISTA, IN ORDINEA PRIMEI FOLOSIRI (DECI NU SUNT STABILE INTRE RULARI)
+inline ComponentTypeID InternalGetComponentTypeID()
+{
+	static std::atomic<ComponentTypeID> lastID(EngineComponents::size); // ID-URILE SUNT COMUNE TUTUROR LUMILOR, CARE POT RULA PE FIRE DIFERITE
+
+	ComponentTypeID typeID = lastID++;
+
+	// UN ID PREA MARE AR IESI DIN SEMNATURA (1ULL << typeID) SI DIN TABELELE INDEXATE DUPA ID, DECI NU SE POATE CONTINUA
+	if (typeID >= MAX_COMPONENTS)
 	{
-		if (WindowManager::instance == nullptr)
-		{
-			WindowManager::instance = new WindowManager();
-		}
+		std::cout << "ERROR :: COMPONENT SYSTEM :: THERE ARE MORE COMPONENT TYPES THAN MAX_COMPONENTS\n";
 
-		return WindowManager::instance;
+		std::abort();
 	}
 
-	void CreateWindow(int windowWidth, int windowHeight, std::string windowTitle)
-	{
-		this->windowWidth = windowWidth;
-		this->windowHeight = windowHeight;
-		this->windowTitle = windowTitle;
+	return typeID;
+}
 
-		glfwInit();
+template<typename T>
+inline ComponentTypeID InternalGetUserComponentTypeID()
+{
+	static const ComponentTypeID typeID = InternalGetComponentTypeID();
+	return typeID;
+}
 
-		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+template<typename T>
+constexpr ComponentTypeID GetComponentTypeID()
+{
+	if constexpr (IsEngineComponent<T>())
+	{
+		return ComponentIndex<T, EngineComponents>::value;
+	}
+	else
+	{
+		return InternalGetUserComponentTypeID<T>();
+	}
+}
 
-		this->window = glfwCreateWindow(this->windowWidth, this->windowHeight, this->windowTitle.c_str(), NULL, NULL);
-		//glfwGetPrimaryMonitor();
+// MASCA DE BITI A UNUI SET DE COMPONENTE. PENTRU COMPONENTELE ENGINE-ULUI E CALCULATA LA COMPILARE
+template<typename... Types>
+constexpr unsigned long long GetComponentSignature()
+{
+	return ((1ULL << GetComponentTypeID<Types>()) | ... | 0ULL);
+}
 
-		glfwMakeContextCurrent(this->window);
+// MAI JOS, TOATE DECLARILE NU SUNT IN ORDINEA DE MAI SUS, DIN CAUZA CA UNELE DEPIND DE ALTELE
 
-		glfwSetInputMode(this->window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+// CLASA MEMORY ARENA
 
-		glewInit();
+// ALOCATOR LINIAR IN BLOCURI MARI. NU ELIBEREAZA ALOCARI INDIVIDUALE, DOAR TOT DEODATA (Reset PASTREAZA BLOCURILE PENTRU REFOLOSIRE)
+// NU E SIGUR PENTRU MAI MULTE FIRE: FIECARE FIR ISI FOLOSESTE PROPRIA ARENA
+class MemoryArena
+{
+public:
 
-		glfwSwapInterval(1);
+	MemoryArena(std::size_t blockSize = 1 << 20) : blockSize(blockSize) {};
+
+	~MemoryArena()
+	{
+		this->Release();
 	}
 
-	void UpdateWindow()
+	void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
 	{
-		glfwSwapBuffers(this->window);
+		while (this->currentBlock < this->blocks.size())
+		{
+			std::uintptr_t address = (std::uintptr_t)(this->blocks[this->currentBlock] + this->currentOffset);
+			std::size_t offset = this->currentOffset + (alignment - address % alignment) % alignment;
 
-		glfwPollEvents();
+			if (offset + size <= this->blockSizes[this->currentBlock])
+			{
+				this->usedBytes += offset + size - this->currentOffset; // CU TOT CU OCTETII SARITI PENTRU ALINIERE
+				this->currentOffset = offset + size;
 
-		glClear(GL_COLOR_BUFFER_BIT);
-	}
+				return this->blocks[this->currentBlock] + offset;
+			}
 
-	void DestroyWindow()
-	{
-		glfwSetWindowShouldClose(this->window, true);
+			this->currentBlock++;
+			this->currentOffset = 0;
+		}
 
-		glfwDestroyWindow(this->window);
+		// UN BLOC NOU, DESTUL DE MARE CA SA CUPRINDA SI ALOCARILE MAI MARI DECAT blockSize
+		std::size_t newBlockSize = std::max(this->blockSize, size + alignment);
 
-		this->window = nullptr;
+		this->blocks.push_back((unsigned char*)::operator new(newBlockSize, std::align_val_t(alignof(std::max_align_t))));
+		this->blockSizes.push_back(newBlockSize);
+		this->reservedBytes += newBlockSize;
+
+		this->currentBlock = this->blocks.size() - 1;
+		this->currentOffset = 0;
+
+		return this->Allocate(size, alignment);
 	}
 
-	void SetWindowShouldClose(bool state)
+	// POZITIA CURENTA, PENTRU Rewind
+	struct Marker
 	{
-		glfwSetWindowShouldClose(this->window, state);
-	}
+		std::size_t block = 0;
+		std::size_t offset = 0;
+		std::size_t usedBytes = 0;
+	};
 
-	void SetClearColor(double red, double green, double blue)
+	Marker GetMarker()
 	{
-		glClearColor(red, green, blue, 1.0);
+		return { this->currentBlock, this->currentOffset, this->usedBytes };
 	}
 
-	void SetClearColor(double red, double green, double blue, double alpha)
+	// ALOCARILE FACUTE DUPA marker DEVIN INVALIDE
+	void Rewind(const Marker& marker)
 	{
-		glClearColor(red, green, blue, alpha);
+		this->currentBlock = marker.block;
+		this->currentOffset = marker.offset;
+		this->usedBytes = marker.usedBytes;
 	}
 
-	bool ShouldWindowClose()
+	// TOATE ALOCARILE DEVIN INVALIDE, DAR MEMORIA RAMANE REZERVATA (SI DEJA ATINSA DE FIRUL CARE FOLOSESTE ARENA)
+	void Reset()
 	{
-		return glfwWindowShouldClose(this->window);
+		this->currentBlock = 0;
+		this->currentOffset = 0;
+		this->usedBytes = 0;
 	}
 
-	GLFWwindow* GetWindow()
+	void Release()
 	{
-		return this->window;
+		for (int i = 0; i < this->blocks.size(); i++)
+		{
+			::operator delete(this->blocks[i], std::align_val_t(alignof(std::max_align_t)));
+		}
+
+		this->blocks.clear();
+		this->blockSizes.clear();
+
+		this->reservedBytes = 0;
+		this->Reset();
 	}
 
-	int GetWindowWidth()
+	std::size_t GetUsedBytes()
 	{
-		return this->windowWidth;
+		return this->usedBytes;
 	}
 
-	int GetWindowHeight()
+	std::size_t GetReservedBytes()
 	{
-		return this->windowHeight;
+		return this->reservedBytes;
 	}
 
 private:
 
-	static WindowManager* instance;
-
-	int windowWidth = 1024;
-	int windowHeight = 768;
+	std::size_t blockSize;
 
-	std::string windowTitle = "GameEngine";
+	std::vector<unsigned char*> blocks;
+	std::vector<std::size_t> blockSizes;
 
-	GLFWwindow* window = nullptr;
+	std::size_t currentBlock = 0;
+	std::size_t currentOffset = 0;
 
-	WindowManager() {};
+	std::size_t usedBytes = 0;
+	std::size_t reservedBytes = 0;
 
-	WindowManager(const WindowManager&) = delete;
+	MemoryArena(const MemoryArena&) = delete;
 };
 
-WindowManager* WindowManager::instance = nullptr;
-
-// CLASA TIME MANAGER
+// CLASA FRAME ALLOCATOR
 
-class TimeManager
+// MEMORIE DE LUCRU PENTRU UN SINGUR CADRU (LISTE DE CANDIDATI, BUFFERE DE SORTARE), CATE UNA PE FIR. ALOCAREA DOAR AVANSEAZA UN POINTER,
+// NIMIC NU SE ELIBEREAZA INDIVIDUAL, IAR LA SFARSITUL LUI GameEngine::Update (SI DUPA FIECARE CADRU AL UNEI SIMULARI DIN BatchRunner) TOTUL E ELIBERAT DEODATA.
+// BLOCURILE RAMAN REZERVATE, DECI DUPA PRIMELE CADRE NU SE MAI ALOCA NIMIC DIN HEAP
+class FrameAllocator
 {
 public:
 
-	static TimeManager* Get()
+	static FrameAllocator* Get()
 	{
-		if (TimeManager::instance == nullptr)
-		{
-			TimeManager::instance = new TimeManager();
-		}
+		thread_local FrameAllocator frameAllocator;
 
-		return TimeManager::instance;
+		return &frameAllocator;
 	}
 
-	void UpdateDeltaTime()
+	void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
 	{
-		this->previousTime = this->currentTime;
-		this->currentTime = glfwGetTime();
-		this->deltaTime = this->currentTime - this->previousTime;
+		void* memory = this->arena.Allocate(size, alignment);
+
+		this->framePeakBytes = std::max(this->framePeakBytes, this->arena.GetUsedBytes());
+
+		return memory;
 	}
 
-	double GetDeltaTime()
+	template<typename T>
+	T* AllocateArray(std::size_t count)
 	{
-		return this->deltaTime;
+		return static_cast<T*>(this->Allocate(sizeof(T) * count, alignof(T)));
 	}
 
-	double GetCurrentTime()
+	// LA SFARSITUL CADRULUI. TOT CE S-A ALOCAT DEVINE INVALID
+	void Reset()
 	{
-		return this->currentTime;
+		this->lastFramePeakBytes = this->framePeakBytes;
+		this->highWaterMark = std::max(this->highWaterMark, this->framePeakBytes);
+
+		this->framePeakBytes = 0;
+
+		this->arena.Reset();
 	}
 
-private:
+	MemoryArena::Marker GetMarker()
+	{
+		return this->arena.GetMarker();
+	}
 
-	double deltaTime = 0.0;
+	void Rewind(const MemoryArena::Marker& marker)
+	{
+		this->arena.Rewind(marker);
+	}
 
-	double currentTime = 0.0;
-	double previousTime = 0.0;
+	std::size_t GetUsedBytes()
+	{
+		return this->arena.GetUsedBytes();
+	}
 
-	static TimeManager* instance;
+	std::size_t GetReservedBytes()
+	{
+		return this->arena.GetReservedBytes();
+	}
 
-	TimeManager()
+	// CEL MAI MULT FOLOSIT INTR-UN CADRU: ULTIMUL CADRU TERMINAT, RESPECTIV DE LA PORNIRE (DE AICI SE ALEGE blockSize)
+	std::size_t GetLastFramePeakBytes()
 	{
-		glfwSetTime(0.0);
+		return this->lastFramePeakBytes;
 	}
 
-	TimeManager(const TimeManager&) = delete;
-};
+	std::size_t GetHighWaterMark()
+	{
+		return std::max(this->highWaterMark, this->framePeakBytes);
+	}
 
-TimeManager* TimeManager::instance = nullptr;
+private:
 
-// CLASA SINGLETON PLAYER
+	MemoryArena arena;
 
-class Player
+	std::size_t framePeakBytes = 0;
+	std::size_t lastFramePeakBytes = 0;
+	std::size_t highWaterMark = 0;
+
+	FrameAllocator() {};
+
+	FrameAllocator(const FrameAllocator&) = delete;
+};
+
+// ELIBEREAZA LA IESIREA DIN BLOC CE S-A ALOCAT IN EL, CA SISTEMELE URMATOARE DIN ACELASI CADRU SA REFOLOSEASCA MEMORIA
+class FrameAllocatorScope
 {
 public:
 
-	static Player* Get()
-	{
-		if (Player::instance == nullptr)
-		{
-			Player::instance = new Player();
-		}
+	FrameAllocatorScope() : marker(FrameAllocator::Get()->GetMarker()) {};
 
-		return Player::instance;
+	~FrameAllocatorScope()
+	{
+		FrameAllocator::Get()->Rewind(this->marker);
 	}
 
-	void SetEntity(Entity* entity)
+private:
+
+	MemoryArena::Marker marker;
+
+	FrameAllocatorScope(const FrameAllocatorScope&) = delete;
+};
+
+// ALOCATOR STL PESTE FrameAllocator-UL FIRULUI CARE L-A CREAT. deallocate NU FACE NIMIC, DECI reserve AJUTA (CRESTEREA LASA BUFFERELE VECHI IN URMA)
+template<typename T>
+class FrameAllocatorAdapter
+{
+public:
+
+	using value_type = T;
+
+	FrameAllocatorAdapter() : frameAllocator(FrameAllocator::Get()) {};
+
+	template<typename U>
+	FrameAllocatorAdapter(const FrameAllocatorAdapter<U>& other) : frameAllocator(other.frameAllocator) {};
+
+	T* allocate(std::size_t count)
 	{
-		this->entity = entity;
+		return this->frameAllocator->AllocateArray<T>(count);
 	}
 
-	Entity* GetEntity()
+	void deallocate(T*, std::size_t)
 	{
-		return this->entity;
+		// MEMORIA E RECUPERATA TOATA ODATA, LA FrameAllocator::Reset
 	}
 
-	void SetCameraShouldFollowPlayer(bool state)
+	template<typename U>
+	bool operator==(const FrameAllocatorAdapter<U>& other) const
 	{
-		this->cameraFollowsPlayer = state;
+		return this->frameAllocator == other.frameAllocator;
 	}
 
-	bool ShouldCameraFollowPlayer()
+	template<typename U>
+	bool operator!=(const FrameAllocatorAdapter<U>& other) const
 	{
-		return this->cameraFollowsPlayer;
+		return this->frameAllocator != other.frameAllocator;
 	}
 
-private:
-
-	static Player* instance;
+	FrameAllocator* frameAllocator;
+};
 
-	Entity* entity;
+// VECTOR TEMPORAR, VALID PANA LA SFARSITUL CADRULUI (SAU AL FrameAllocatorScope-ULUI IN CARE A FOST CREAT)
+template<typename T>
+using FrameVector = std::vector<T, FrameAllocatorAdapter<T>>;
 
-	bool cameraFollowsPlayer;
+// CLASA METRICS REGISTRY
 
-	Player()
-	{
-		this->entity = nullptr;
+// METRICILE ENGINE-ULUI, INREGISTRATE PRIMELE, IN ACEASTA ORDINE (CELE ALE JOCULUI PRIMESC ID-URI DUPA ELE)
+namespace Metric
+{
+	// CONTOARE: CRESC MEREU, IAR PE CADRU SE EXPORTA CAT AU CRESCUT
+	const int AABB_TESTS = 0; // CollisionManager::UpdateCollisions
+	const int COLLISION_PUSHES = 1; // CARACTERE SCOASE DIN TEREN
+	const int BULLETS_REMOVED = 2;
+	const int ANIMATION_FRAME_FLIPS = 3; // TEXTURI SCHIMBATE DE AnimationManager
+	const int ANIMATION_STATE_CHANGES = 4;
+	const int SPRITES_SUBMITTED = 5; // RenderQueue::Flush
+	const int DRAW_CALLS = 6;
+	const int UPLOADED_BYTES = 7;
+
+	// VALORI: ULTIMA VALOARE DATA. SUNT COMUNE PROCESULUI, ASA CA GameEngine LE SETEAZA DOAR DIN LUMEA IMPLICITA (CELELALTE LUMI SI-AR SUPRASCRIE VALORILE)
+	const int CHARACTER_COUNT = 0;
+	const int TERRAIN_COUNT = 1;
+	const int BULLET_COUNT = 2;
+	const int LANDSCAPE_COUNT = 3;
+	const int ANIMATED_ENTITY_COUNT = 4;
+	const int ARTIFICIAL_INTELLIGENCE_COUNT = 5;
+	const int ACTIVE_ARTIFICIAL_INTELLIGENCE_COUNT = 6;
+	const int FRAME_ALLOCATOR_BYTES = 7; // VARFUL DIN ULTIMUL CADRU
+
+	// HISTOGRAME
+	const int FRAME_TIME = 0; // IN MICROSECUNDE
+	const int SPRITES_PER_DRAW = 1;
+}
 
-		this->cameraFollowsPlayer = false;
-	}
+enum class MetricType
+{
+	counter,
+	gauge,
+	histogram,
+};
 
-	Player(const Player&) = delete;
+// LUMEA DIN CARE VIN CONTOARELE SI HISTOGRAMELE. CADRELE (EndFrame, EXPORTUL) FOLOSESC DOAR LUMEA IMPLICITA, A JOCULUI,
+// CA SIMULARILE DIN ALTE LUMI (BatchRunner, TESTE) SA NU SE AMESTECE IN CIFRELE CADRULUI
+enum class MetricsSource
+{
+	defaultWorld,
+	otherWorlds,
 };
 
-Player* Player::instance = nullptr;
+enum class MetricsFormat
+{
+	csv, // UN RAND PE CADRU, CU COLOANELE METRICILOR INREGISTRATE LA StartExport
+	json, // UN OBIECT PE LINIE, PE CADRU (JSON LINES)
+};
 
-// CLASA ENTITY MANAGER
+// HISTOGRAMELE AU GALETI PUTERI ALE LUI 2: GALEATA 0 PENTRU VALORI SUB 1, GALEATA b PENTRU [2^(b-1), 2^b)
+const int METRICS_HISTOGRAM_BUCKETS = 32;
 
-class EntityManager
+struct MetricsHistogram
 {
-public:
+	long long count = 0;
+	double sum = 0.0;
 
-	static EntityManager* Get()
+	std::array<long long, METRICS_HISTOGRAM_BUCKETS> buckets = {};
+
+	double GetMean() const
+	{
+		return this->count == 0 ? 0.0 : this->sum / this->count;
+	}
+
+	// LIMITA DE SUS A GALETII IN CARE CADE PERCENTILA (0..1)
+	double GetPercentile(double percentile) const
 	{
-		if (EntityManager::instance == nullptr)
+		long long target = (long long)std::ceil(percentile * this->count);
+		long long seen = 0;
+
+		for (int i = 0; i < METRICS_HISTOGRAM_BUCKETS; i++)
 		{
-			EntityManager::instance = new EntityManager();
+			seen += this->buckets[i];
+
+			if (seen >= target && seen > 0)
+			{
+				return std::ldexp(1.0, i);
+			}
 		}
 
-		return EntityManager::instance;
+		return 0.0;
 	}
+};
 
-	void AddCharacter(Entity* entity)
+// CAT A LUCRAT FIECARE CADRU (NU CAT A DURAT): CONTOARE, VALORI SI HISTOGRAME, COMUNE PROCESULUI (TOATE LUMILE SI TOATE FIRELE).
+// CONTOARELE SI HISTOGRAMELE SUNT TINUTE PE FIR (FIECARE FIR SCRIE DOAR IN PROPRIA COPIE, FARA OPERATII ATOMICE CU BLOCARE) SI ADUNATE LA CITIRE,
+// SEPARAT PENTRU LUMEA IMPLICITA SI PENTRU CELELALTE LUMI (MetricsSource).
+// SISTEMELE ADUNA IN VARIABILE LOCALE SI APELEAZA Add O DATA PE CADRU. GameEngine::Update INCHIDE CADRUL CU EndFrame, CARE IL SI EXPORTA
+class MetricsRegistry
+{
+public:
+
+	static MetricsRegistry* Get()
 	{
-		this->characters.push_back(entity);
+		// STATIC LOCAL, PENTRU CA E CERUT DE PE TOATE FIRELE (INCLUSIV CELE ALE LUI BatchRunner)
+		static MetricsRegistry* metricsRegistry = new MetricsRegistry();
+
+		return metricsRegistry;
 	}
 
-	void AddTerrain(Entity* entity)
+	static const int MAX_COUNTERS = 64;
+	static const int MAX_GAUGES = 64;
+	static const int MAX_HISTOGRAMS = 16;
+
+	// ACELASI NUME INTOARCE ACELASI ID. -1 DACA NU MAI E LOC
+	int RegisterCounter(const std::string& name)
 	{
-		this->terrains.push_back(entity);
+		return this->Register(MetricType::counter, name, MetricsRegistry::MAX_COUNTERS);
 	}
 
-	void AddBullet(Entity* entity)
+	int RegisterGauge(const std::string& name)
 	{
-		this->bullets.push_back(entity);
+		return this->Register(MetricType::gauge, name, MetricsRegistry::MAX_GAUGES);
 	}
 
-	void AddAnimatedEntity(Entity* entity)
+	int RegisterHistogram(const std::string& name)
 	{
-		this->animatedEntities.push_back(entity);
+		return this->Register(MetricType::histogram, name, MetricsRegistry::MAX_HISTOGRAMS);
 	}
 
-	void AddArtificialIntelligence(Entity* entity)
+	// -1 DACA NU EXISTA
+	int FindMetric(MetricType type, const std::string& name)
 	{
-		this->artificalIntelligence.push_back(entity);
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		std::unordered_map<std::string, int>::iterator it = this->ids[(int)type].find(name);
+
+		return it == this->ids[(int)type].end() ? -1 : it->second;
 	}
 
-	void RemoveCharacter(Entity* entity) // DOAR ELIMINA DIN MANAGER. ARE OVERHEAD DE MEMORIE DACA NU STERGEM ENTITATEA MANUAL
+	void SetEnabled(bool isEnabled)
 	{
-		for (int i = 0; i < this->characters.size(); i++)
-		{
-			if (this->characters[i] == entity)
-			{
-				this->characters[i] = this->characters[this->characters.size() - 1];
-				this->characters.pop_back();
-
-				return;
-			}
-		}
+		this->isEnabled.store(isEnabled, std::memory_order_relaxed);
 	}
 
-	void RemoveTerrain(Entity* entity) // DOAR ELIMINA DIN MANAGER. ARE OVERHEAD DE MEMORIE DACA NU STERGEM ENTITATEA MANUAL
+	void Add(int counter, long long value = 1)
 	{
-		for (int i = 0; i < this->terrains.size(); i++)
+		if (!this->isEnabled.load(std::memory_order_relaxed) || counter < 0)
 		{
-			if (this->terrains[i] == entity)
-			{
-				this->terrains[i] = this->terrains[this->terrains.size() - 1];
-				this->terrains.pop_back();
-
-				return;
-			}
+			return;
 		}
+
+		std::atomic<long long>& total = MetricsRegistry::GetShard()->counters[counter];
+		total.store(total.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
 	}
 
-	void RemoveBullet(Entity* entity)
+	void Set(int gauge, double value)
 	{
-		for (int i = 0; i < this->bullets.size(); i++)
+		if (!this->isEnabled.load(std::memory_order_relaxed) || gauge < 0)
 		{
-			if (this->bullets[i] == entity)
-			{
-				this->bullets[i] = this->bullets[this->bullets.size() - 1];
-				this->bullets.pop_back();
-
-				return;
-			}
+			return;
 		}
+
+		this->gauges[gauge].store(value, std::memory_order_relaxed);
 	}
 
-	void RemoveAnimatedEntity(Entity* entity)
+	void Record(int histogram, double value)
 	{
-		for (int i = 0; i < this->animatedEntities.size(); i++)
+		if (!this->isEnabled.load(std::memory_order_relaxed) || histogram < 0)
 		{
-			if (this->animatedEntities[i] == entity)
-			{
-				this->animatedEntities[i] = this->animatedEntities[this->animatedEntities.size() - 1];
-				this->animatedEntities.pop_back();
-
-				return;
-			}
+			return;
 		}
-	}
 
-	void RemoveArtificialIntelligence(Entity* entity)
-	{
-		for (int i = 0; i < this->artificalIntelligence.size(); i++)
-		{
-			if (this->artificalIntelligence[i] == entity)
-			{
-				this->artificalIntelligence[i] = this->artificalIntelligence[this->artificalIntelligence.size() - 1];
-				this->artificalIntelligence.pop_back();
+		MetricsShard* shard = MetricsRegistry::GetShard();
 
-				return;
-			}
-		}
-	}
+		std::atomic<long long>& bucket = shard->histogramBuckets[histogram][MetricsRegistry::GetBucket(value)];
+		bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
 
-	void RemoveCharacter(int index)
-	{
-		if (0 <= index && index <= this->characters.size())
-		{
-			this->characters[index] = this->characters[this->characters.size() - 1];
-			this->characters.pop_back();
-		}
+		std::atomic<double>& sum = shard->histogramSums[histogram];
+		sum.store(sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
 	}
 
-	void RemoveTerrain(int index)
+	// TOTALUL, DE LA PORNIRE
+	long long GetCounter(int counter, MetricsSource source = MetricsSource::defaultWorld)
 	{
-		if (0 <= index && index <= this->terrains.size())
-		{
-			this->terrains[index] = this->terrains[this->terrains.size() - 1];
-			this->terrains.pop_back();
-		}
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		return this->SumCounter(counter, source);
 	}
 
-	void RemoveBullet(int index)
+	// CAT A CRESCUT IN ULTIMUL CADRU INCHIS (DOAR LUMEA IMPLICITA)
+	long long GetFrameCounter(int counter)
 	{
-		if (0 <= index && index <= this->bullets.size())
-		{
-			this->bullets[index] = this->bullets[this->bullets.size() - 1];
-			this->bullets.pop_back();
-		}
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		return this->frameCounters[counter];
 	}
 
-	void RemoveAnimatedEntity(int index)
+	double GetGauge(int gauge)
 	{
-		if (0 <= index && index <= this->animatedEntities.size())
-		{
-			this->animatedEntities[index] = this->animatedEntities[this->animatedEntities.size() - 1];
-			this->animatedEntities.pop_back();
-		}
+		return this->gauges[gauge].load(std::memory_order_relaxed);
 	}
 
-	void RemoveArtificialIntelligence(int index)
+	MetricsHistogram GetHistogram(int histogram, MetricsSource source = MetricsSource::defaultWorld)
 	{
-		if (0 <= index && index <= this->artificalIntelligence.size())
-		{
-			this->artificalIntelligence[index] = this->artificalIntelligence[this->artificalIntelligence.size() - 1];
-			this->artificalIntelligence.pop_back();
-		}
+		std::lock_guard<std::mutex> lock(this->mutex);
+
+		MetricsHistogram result;
+		this->SumHistogram(histogram, source, result);
+
+		return result;
 	}
 
-	void RemoveAllEntities() // DOAR ELIMINA DIN MANAGER. ARE OVERHEAD DE MEMORIE DACA NU STERGEM ENTITATEA MANUAL
+	// O COPIE, PENTRU CA Register POATE MUTA NUMELE PE ALT FIR
+	std::string GetName(MetricType type, int id)
 	{
-		this->characters.clear();
-		this->terrains.clear();
-		this->bullets.clear();
+		std::lock_guard<std::mutex> lock(this->mutex);
 
-		this->animatedEntities.clear();
+		return this->names[(int)type][id];
 	}
 
-	std::vector<Entity*> characters;
-	std::vector<Entity*> terrains;
-	std::vector<Entity*> bullets;
-
-	std::vector<Entity*> animatedEntities;
+	int GetMetricCount(MetricType type)
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
 
-	std::vector<Entity*> artificalIntelligence;
+		return (int)this->names[(int)type].size();
+	}
 
-private:
+	long long GetFrameIndex()
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
 
-	static EntityManager* instance;
+		return this->frameIndex;
+	}
 
-	EntityManager() {};
+	// DE LA URMATORUL EndFrame, FIECARE CADRU E SCRIS IN FISIER
+	bool StartExport(const std::string& path, MetricsFormat format)
+	{
+		this->StopExport();
 
-	EntityManager(const EntityManager&) = delete;
-};
+		this->exportFile.open(path, std::ios::out | std::ios::trunc);
 
-EntityManager* EntityManager::instance = nullptr;
+		if (!this->exportFile.is_open())
+		{
+			std::cout << "ERROR :: METRICS REGISTRY :: STARTEXPORT :: COULD NOT OPEN THE FILE \"" << path << "\"\n";
 
-// STRUCTURA TEXTURA
+			return false;
+		}
 
-struct Texture
-{
-	unsigned int ID = 0;
+		this->exportFormat = format;
 
-	int width = 0;
-	int height = 0;
+		std::lock_guard<std::mutex> lock(this->mutex);
 
-	int nrChannels = 0;
-};
+		for (int type = 0; type < 3; type++)
+		{
+			this->exportedMetrics[type] = (int)this->names[type].size();
+		}
 
-// CLASA ASSET MANAGER
+		if (format == MetricsFormat::csv)
+		{
+			this->exportFile << "frame";
 
-class AssetManager
-{
-public:
+			for (int i = 0; i < this->exportedMetrics[(int)MetricType::counter]; i++)
+			{
+				this->exportFile << "," << this->names[(int)MetricType::counter][i];
+			}
+			for (int i = 0; i < this->exportedMetrics[(int)MetricType::gauge]; i++)
+			{
+				this->exportFile << "," << this->names[(int)MetricType::gauge][i];
+			}
+			for (int i = 0; i < this->exportedMetrics[(int)MetricType::histogram]; i++)
+			{
+				this->exportFile << "," << this->names[(int)MetricType::histogram][i] << ".count," << this->names[(int)MetricType::histogram][i] << ".mean";
+			}
 
-	static AssetManager* Get()
-	{
-		if (AssetManager::instance == nullptr)
-		{
-			AssetManager::instance = new AssetManager();
+			this->exportFile << "\n";
 		}
 
-		return AssetManager::instance;
+		return true;
 	}
 
-	void ClearTextureData()
+	void StopExport()
 	{
-		this->textures.clear();
+		if (this->exportFile.is_open())
+		{
+			this->exportFile.close();
+		}
 	}
 
-	void AddTexture(std::string name, std::string address)
+	// INCHIDE CADRUL: CALCULEAZA CAT AU CRESCUT CONTOARELE SI HISTOGRAMELE SI, DACA E CAZUL, SCRIE CADRUL
+	void EndFrame()
 	{
-		Texture texture;
+		std::lock_guard<std::mutex> lock(this->mutex);
 
-		glGenTextures(1, &texture.ID);
-		glBindTexture(GL_TEXTURE_2D, texture.ID);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		for (int i = 0; i < this->names[(int)MetricType::counter].size(); i++)
+		{
+			long long total = this->SumCounter(i, MetricsSource::defaultWorld);
 
-		unsigned char* data = SOIL_load_image(address.c_str(), &texture.width, &texture.height, &texture.nrChannels, 0);
+			this->frameCounters[i] = total - this->previousCounters[i];
+			this->previousCounters[i] = total;
+		}
 
-		if (data)
+		for (int i = 0; i < this->names[(int)MetricType::histogram].size(); i++)
 		{
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texture.width, texture.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-			glGenerateMipmap(GL_TEXTURE_2D);
+			MetricsHistogram histogram;
+			this->SumHistogram(i, MetricsSource::defaultWorld, histogram);
 
-			this->textures.insert({ name, texture });
+			this->frameHistogramCounts[i] = histogram.count - this->previousHistogramCounts[i];
+			this->frameHistogramSums[i] = histogram.sum - this->previousHistogramSums[i];
+			this->previousHistogramCounts[i] = histogram.count;
+			this->previousHistogramSums[i] = histogram.sum;
 		}
-		else
+
+		if (this->exportFile.is_open())
 		{
-			std::cout << "ERROR :: ASSET MANAGER :: ADDTEXTURE :: COULD NOT FIND THE TEXTURED NAMED \"" << name << "\" AT THE ADDRESS \"" << address << "\"\n";
+			this->WriteFrame();
 		}
 
-		SOIL_free_image_data(data);
+		this->frameIndex++;
 	}
 
-	void DeleteTexture(std::string name)
-	{
-		this->textures.erase(name);
-	}
+private:
 
-	unsigned int GetTextureID(std::string name)
+	// COPIA UNUI FIR. SCRISA DOAR DE FIRUL EI, CITITA (SUB mutex) LA ADUNARE
+	struct MetricsShard
 	{
-		if (this->textures.find(name) == this->textures.end())
+		std::array<std::atomic<long long>, MetricsRegistry::MAX_COUNTERS> counters;
+		std::array<std::array<std::atomic<long long>, METRICS_HISTOGRAM_BUCKETS>, MetricsRegistry::MAX_HISTOGRAMS> histogramBuckets;
+		std::array<std::atomic<double>, MetricsRegistry::MAX_HISTOGRAMS> histogramSums;
+
+		MetricsShard()
 		{
-			std::cout << "ERROR :: ASSET MANAGER :: GETTEXTUREID :: COULD NOT FIND THE TEXTURE NAMED \"" << name << "\". RETURNING ERROR TEXTURE ID INSTEAD...\n";
+			for (int i = 0; i < MetricsRegistry::MAX_COUNTERS; i++)
+			{
+				this->counters[i].store(0, std::memory_order_relaxed);
+			}
 
-			return this->errorTexture.ID;
+			for (int i = 0; i < MetricsRegistry::MAX_HISTOGRAMS; i++)
+			{
+				for (int j = 0; j < METRICS_HISTOGRAM_BUCKETS; j++)
+				{
+					this->histogramBuckets[i][j].store(0, std::memory_order_relaxed);
+				}
+
+				this->histogramSums[i].store(0.0, std::memory_order_relaxed);
+			}
 		}
+	};
 
-		return this->textures[name].ID;
+	// O COPIE PE FIR PENTRU FIECARE MetricsSource. LA IESIREA FIRULUI, VALORILE LUI SUNT MUTATE IN retiredShards, CA TOTALURILE SA NU SCADA
+	struct MetricsShardOwner
+	{
+		MetricsShard* shards[2];
 
-	}
+		MetricsShardOwner()
+		{
+			MetricsRegistry* registry = MetricsRegistry::Get();
 
-	unsigned int GetErrorTextureID()
-	{
-		return this->errorTexture.ID;
-	}
+			std::lock_guard<std::mutex> lock(registry->mutex);
 
-private:
+			for (int source = 0; source < 2; source++)
+			{
+				this->shards[source] = new MetricsShard();
+				registry->shards[source].push_back(this->shards[source]);
+			}
+		}
 
-	static AssetManager* instance;
+		~MetricsShardOwner()
+		{
+			MetricsRegistry* registry = MetricsRegistry::Get();
 
-	Texture errorTexture;
-	std::unordered_map<std::string, Texture> textures;
+			std::lock_guard<std::mutex> lock(registry->mutex);
 
-	std::string errorTextureAddress = "GameEngine/Textures/ErrorTexture/ErrorTexture.png";
+			for (int source = 0; source < 2; source++)
+			{
+				MetricsShard* shard = this->shards[source];
+				MetricsShard& retiredShard = registry->retiredShards[source];
 
-	AssetManager()
-	{
-		glGenTextures(1, &this->errorTexture.ID);
-		glBindTexture(GL_TEXTURE_2D, this->errorTexture.ID);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+				for (int i = 0; i < MetricsRegistry::MAX_COUNTERS; i++)
+				{
+					retiredShard.counters[i].store(retiredShard.counters[i].load() + shard->counters[i].load());
+				}
 
-		unsigned char* data = SOIL_load_image(this->errorTextureAddress.c_str(), &this->errorTexture.width, &this->errorTexture.height, &this->errorTexture.nrChannels, 0);
+				for (int i = 0; i < MetricsRegistry::MAX_HISTOGRAMS; i++)
+				{
+					for (int j = 0; j < METRICS_HISTOGRAM_BUCKETS; j++)
+					{
+						retiredShard.histogramBuckets[i][j].store(retiredShard.histogramBuckets[i][j].load() + shard->histogramBuckets[i][j].load());
+					}
 
-		if (data)
-		{
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->errorTexture.width, this->errorTexture.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-			glGenerateMipmap(GL_TEXTURE_2D);
-		}
-		else
-		{
-			std::cout << "ERROR :: ASSET MANAGER :: COULD NOT FIND THE ERROR TEXTURE AT THE ADDRESS \"" << this->errorTextureAddress << "\"\n";
-		}
+					retiredShard.histogramSums[i].store(retiredShard.histogramSums[i].load() + shard->histogramSums[i].load());
+				}
 
-		SOIL_free_image_data(data);
+				registry->shards[source].erase(std::find(registry->shards[source].begin(), registry->shards[source].end(), shard));
+
+				delete shard;
+			}
+		}
 	};
 
-	AssetManager(const AssetManager&) = delete;
-};
+	std::mutex mutex;
 
-AssetManager* AssetManager::instance = nullptr;
+	std::vector<MetricsShard*> shards[2]; // PE MetricsSource
+	MetricsShard retiredShards[2];
 
-// CLASA RENDERER2D
+	std::atomic<bool> isEnabled;
 
-class Renderer2D
-{
-public:
+	std::vector<std::string> names[3];
+	std::unordered_map<std::string, int> ids[3];
 
-	Renderer2D(std::string vertexShaderAddress, std::string fragmentShaderAddress)
-	{
+	std::array<std::atomic<double>, MetricsRegistry::MAX_GAUGES> gauges;
 
-		std::ifstream fileInput;
-		std::string line;
+	std::array<long long, MetricsRegistry::MAX_COUNTERS> previousCounters = {};
+	std::array<long long, MetricsRegistry::MAX_COUNTERS> frameCounters = {};
 
-		fileInput.open(vertexShaderAddress);
+	std::array<long long, MetricsRegistry::MAX_HISTOGRAMS> previousHistogramCounts = {};
+	std::array<double, MetricsRegistry::MAX_HISTOGRAMS> previousHistogramSums = {};
+	std::array<long long, MetricsRegistry::MAX_HISTOGRAMS> frameHistogramCounts = {};
+	std::array<double, MetricsRegistry::MAX_HISTOGRAMS> frameHistogramSums = {};
 
-		if (fileInput)
-		{
-			while (!fileInput.eof())
-			{
-				getline(fileInput, line);
+	long long frameIndex = 0;
 
-				this->vertexShaderCode += line;
-				this->vertexShaderCode += "\n";
-			}
+	std::ofstream exportFile;
+	MetricsFormat exportFormat = MetricsFormat::csv;
+	int exportedMetrics[3] = {};
 
-			this->vertexShaderCode += "\0";
-		}
-		else
+	// COPIA FIRULUI PENTRU LUMEA CURENTA (DEFINIT DUPA World)
+	static MetricsShard* GetShard();
+
+	static int GetBucket(double value)
+	{
+		if (!(value >= 1.0))
 		{
-			std::cout << "ERROR :: RENDERER2D :: COULD NOT FIND ANY FILE AT THE ADDRESS \"" << vertexShaderAddress << "\" WHICH CONTAINS THE VERTEX SHADER CODE\n";
+			return 0;
 		}
 
-		fileInput.close();
+		int exponent;
+		std::frexp(value, &exponent); // value = m * 2^exponent, m IN [0.5, 1)
 
-		fileInput.open(fragmentShaderAddress);
+		return std::min(exponent, METRICS_HISTOGRAM_BUCKETS - 1);
+	}
 
-		if (fileInput)
-		{
-			while (!fileInput.eof())
-			{
-				getline(fileInput, line);
+	int Register(MetricType type, const std::string& name, int maxMetrics)
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
 
-				this->fragmentShaderCode += line;
-				this->fragmentShaderCode += "\n";
-			}
+		std::unordered_map<std::string, int>::iterator it = this->ids[(int)type].find(name);
 
-			this->fragmentShaderCode += "\0";
-		}
-		else
+		if (it != this->ids[(int)type].end())
 		{
-			std::cout << "ERROR :: RENDERER2D :: COULD NOT FIND ANY FILE AT THE ADDRESS \"" << fragmentShaderAddress << "\" WHICH CONTAINS THE FRAGMENT SHADER CODE\n";
+			return it->second;
 		}
 
-		fileInput.close();
-
-		const char* vertexCstr = (this->vertexShaderCode).c_str();
-		const char* fragmentCstr = (this->fragmentShaderCode).c_str();
+		if (this->names[(int)type].size() >= maxMetrics)
+		{
+			std::cout << "ERROR :: METRICS REGISTRY :: REGISTER :: THERE IS NO ROOM LEFT FOR THE METRIC \"" << name << "\"\n";
 
-		this->vertexShaderID = glCreateShader(GL_VERTEX_SHADER);
-		this->fragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
+			return -1;
+		}
 
-		glShaderSource(this->vertexShaderID, 1, &vertexCstr, 0);
-		glShaderSource(this->fragmentShaderID, 1, &fragmentCstr, 0);
+		int id = (int)this->names[(int)type].size();
 
-		glCompileShader(this->vertexShaderID);
-		glCompileShader(this->fragmentShaderID);
+		this->names[(int)type].push_back(name);
+		this->ids[(int)type][name] = id;
 
-		this->programID = glCreateProgram();
-		glAttachShader(this->programID, this->vertexShaderID);
-		glAttachShader(this->programID, this->fragmentShaderID);
+		return id;
+	}
 
-		glLinkProgram(this->programID);
+	long long SumCounter(int counter, MetricsSource source)
+	{
+		std::vector<MetricsShard*>& shards = this->shards[(int)source];
 
-		//glValidateProgram(this->programID);
+		long long total = this->retiredShards[(int)source].counters[counter].load(std::memory_order_relaxed);
 
-		glUseProgram(this->programID);
+		for (int i = 0; i < shards.size(); i++)
+		{
+			total += shards[i]->counters[counter].load(std::memory_order_relaxed);
+		}
 
-		glGenVertexArrays(1, &this->VAOID);
-		glGenBuffers(1, &this->VBOID);
+		return total;
+	}
 
-		glBindVertexArray(this->VAOID);
-		glBindBuffer(GL_ARRAY_BUFFER, this->VBOID);
+	void SumHistogram(int histogram, MetricsSource source, MetricsHistogram& result)
+	{
+		std::vector<MetricsShard*>& shards = this->shards[(int)source];
+		MetricsShard& retiredShard = this->retiredShards[(int)source];
 
-		glVertexAttribPointer(0, 2, GL_DOUBLE, GL_FALSE, 4 * sizeof(double), (void*)0);
-		glEnableVertexAttribArray(0);
-		glVertexAttribPointer(1, 2, GL_DOUBLE, GL_FALSE, 4 * sizeof(double), (void*)(2 * sizeof(double)));
-		glEnableVertexAttribArray(1);
+		for (int j = 0; j < METRICS_HISTOGRAM_BUCKETS; j++)
+		{
+			result.buckets[j] = retiredShard.histogramBuckets[histogram][j].load(std::memory_order_relaxed);
 
-		this->ortho = glm::ortho(0.0, 1.0 * WindowManager::Get()->GetWindowWidth(), 0.0, 1.0 * WindowManager::Get()->GetWindowHeight());
-		this->orthoPath = glGetUniformLocation(this->programID, "ortho");
-		glUniformMatrix4fv(this->orthoPath, 1, GL_FALSE, glm::value_ptr(this->ortho));
+			for (int i = 0; i < shards.size(); i++)
+			{
+				result.buckets[j] += shards[i]->histogramBuckets[histogram][j].load(std::memory_order_relaxed);
+			}
 
-		this->texturePath = glGetUniformLocation(this->programID, "texture0");
-		glUniform1i(this->texturePath, 0);
+			result.count += result.buckets[j];
+		}
 
-		glActiveTexture(GL_TEXTURE0);
+		result.sum = retiredShard.histogramSums[histogram].load(std::memory_order_relaxed);
 
-		glUseProgram(0);
+		for (int i = 0; i < shards.size(); i++)
+		{
+			result.sum += shards[i]->histogramSums[histogram].load(std::memory_order_relaxed);
+		}
 	}
 
-	~Renderer2D()
+	void WriteFrame()
 	{
-		glDeleteBuffers(1, &this->VBOID);
-		glDeleteVertexArrays(1, &this->VAOID);
+		int counters = this->exportedMetrics[(int)MetricType::counter];
+		int gauges = this->exportedMetrics[(int)MetricType::gauge];
+		int histograms = this->exportedMetrics[(int)MetricType::histogram];
+
+		if (this->exportFormat == MetricsFormat::csv)
+		{
+			this->exportFile << this->frameIndex;
+
+			for (int i = 0; i < counters; i++)
+			{
+				this->exportFile << "," << this->frameCounters[i];
+			}
+			for (int i = 0; i < gauges; i++)
+			{
+				this->exportFile << "," << this->gauges[i].load(std::memory_order_relaxed);
+			}
+			for (int i = 0; i < histograms; i++)
+			{
+				this->exportFile << "," << this->frameHistogramCounts[i] << "," << (this->frameHistogramCounts[i] == 0 ? 0.0 : this->frameHistogramSums[i] / this->frameHistogramCounts[i]);
+			}
+
+			this->exportFile << "\n";
+
+			return;
+		}
 
-		glDeleteShader(this->vertexShaderID);
-		glDeleteShader(this->fragmentShaderID);
+		// IN JSON APAR SI METRICILE INREGISTRATE DUPA StartExport
+		counters = (int)this->names[(int)MetricType::counter].size();
+		gauges = (int)this->names[(int)MetricType::gauge].size();
+		histograms = (int)this->names[(int)MetricType::histogram].size();
 
-		glDeleteProgram(this->programID);
+		this->exportFile << "{\"frame\":" << this->frameIndex;
+
+		for (int i = 0; i < counters; i++)
+		{
+			this->exportFile << ",\"" << this->names[(int)MetricType::counter][i] << "\":" << this->frameCounters[i];
+		}
+		for (int i = 0; i < gauges; i++)
+		{
+			this->exportFile << ",\"" << this->names[(int)MetricType::gauge][i] << "\":" << this->gauges[i].load(std::memory_order_relaxed);
+		}
+		for (int i = 0; i < histograms; i++)
+		{
+			this->exportFile << ",\"" << this->names[(int)MetricType::histogram][i] << "\":{\"count\":" << this->frameHistogramCounts[i]
+				<< ",\"mean\":" << (this->frameHistogramCounts[i] == 0 ? 0.0 : this->frameHistogramSums[i] / this->frameHistogramCounts[i]) << "}";
+		}
+
+		this->exportFile << "}\n";
 	}
 
-	inline void StartUsing()
+	MetricsRegistry()
 	{
-		glUseProgram(this->programID);
+		this->isEnabled.store(true, std::memory_order_relaxed);
+
+		for (int i = 0; i < MetricsRegistry::MAX_GAUGES; i++)
+		{
+			this->gauges[i].store(0.0, std::memory_order_relaxed);
+		}
+
+		// IN ORDINEA DIN namespace Metric
+		const char* counterNames[] = { "collision.aabb_tests", "collision.pushes", "collision.bullets_removed", "animation.frame_flips", "animation.state_changes",
+			"render.sprites", "render.draw_calls", "render.uploaded_bytes" };
+		const char* gaugeNames[] = { "entities.characters", "entities.terrains", "entities.bullets", "entities.landscapes", "entities.animated",
+			"entities.artificial_intelligence", "entities.active_artificial_intelligence", "memory.frame_allocator_bytes" };
+		const char* histogramNames[] = { "frame.time_us", "render.sprites_per_draw" };
+
+		for (const char* name : counterNames)
+		{
+			this->Register(MetricType::counter, name, MetricsRegistry::MAX_COUNTERS);
+		}
+		for (const char* name : gaugeNames)
+		{
+			this->Register(MetricType::gauge, name, MetricsRegistry::MAX_GAUGES);
+		}
+		for (const char* name : histogramNames)
+		{
+			this->Register(MetricType::histogram, name, MetricsRegistry::MAX_HISTOGRAMS);
+		}
 	}
 
-	inline void StopUsing()
+	MetricsRegistry(const MetricsRegistry&) = delete;
+};
+
+// CLASA PERFORMANCE COUNTERS
+
+// SISTEMELE CARORA LE SUNT ATRIBUITE CONTOARELE HARDWARE, IN ORDINEA DIN GameEngine::UpdateSystems (render E RenderQueue::Flush DIN GameEngine::Update)
+enum class EngineSystem
+{
+	input = 0,
+	movement = 1,
+	collision = 2,
+	animation = 3,
+	artificialIntelligence = 4,
+	camera = 5,
+	spatialOrder = 6,
+	snapshot = 7,
+	render = 8,
+};
+
+const int ENGINE_SYSTEM_COUNT = 9;
+
+enum class HardwareCounter
+{
+	cycles = 0,
+	instructions = 1,
+	l1DataMisses = 2, // CITIRI RATATE IN CACHE-UL L1 DE DATE
+	lastLevelCacheMisses = 3,
+	branchMisses = 4,
+};
+
+const int HARDWARE_COUNTER_COUNT = 5;
+
+struct SystemCounters
+{
+	long long scopes = 0; // CATE SCOPURI MASURATE (DE OBICEI CATE CADRE)
+
+	std::array<long long, HARDWARE_COUNTER_COUNT> values = {};
+
+	long long Get(HardwareCounter counter) const
 	{
-		glUseProgram(0);
+		return this->values[(int)counter];
 	}
 
-	unsigned int GetVAOID()
+	double GetPerScope(HardwareCounter counter) const
 	{
-		return this->VAOID;
+		return this->scopes == 0 ? 0.0 : (double)this->values[(int)counter] / this->scopes;
 	}
 
-	unsigned int GetVBOID()
+	double GetInstructionsPerCycle() const
 	{
-		return this->VBOID;
-	}
+		long long cycles = this->values[(int)HardwareCounter::cycles];
 
-private:
+		return cycles == 0 ? 0.0 : (double)this->values[(int)HardwareCounter::instructions] / cycles;
+	}
+};
 
-	int programID;
+struct HardwareCounterReport
+{
+	std::array<bool, HARDWARE_COUNTER_COUNT> isAvailable = {}; // UN CONTOR INDISPONIBIL RAMANE 0 IN TOATE SISTEMELE
 
-	int vertexShaderID;
-	int fragmentShaderID;
+	std::array<SystemCounters, ENGINE_SYSTEM_COUNT> systems;
 
-	std::string vertexShaderCode;
-	std::string fragmentShaderCode;
+	bool HasCounters() const
+	{
+		return std::find(this->isAvailable.begin(), this->isAvailable.end(), true) != this->isAvailable.end();
+	}
 
-	int orthoPath;
-	glm::mat4 ortho;
+	// ADUNA RAPORTUL ALTUI FIR
+	void Merge(const HardwareCounterReport& other)
+	{
+		for (int i = 0; i < HARDWARE_COUNTER_COUNT; i++)
+		{
+			this->isAvailable[i] = this->isAvailable[i] || other.isAvailable[i];
+		}
 
-	int texturePath;
+		for (int i = 0; i < ENGINE_SYSTEM_COUNT; i++)
+		{
+			this->systems[i].scopes += other.systems[i].scopes;
 
-	unsigned int VAOID;
-	unsigned int VBOID;
+			for (int j = 0; j < HARDWARE_COUNTER_COUNT; j++)
+			{
+				this->systems[i].values[j] += other.systems[i].values[j];
+			}
+		}
+	}
 };
 
-// CLASA COMPONENT
-
-class Component
+// CICLI, INSTRUCTIUNI, RATARI IN L1 SI IN ULTIMUL NIVEL DE CACHE SI RAMIFICATII PREZISE GRESIT, ATRIBUITE FIECARUI SISTEM (VEZI PerformanceCounterScope)
+// OPTIONALE (SetEnabled) SI DOAR PE LINUX. perf_event_open MASOARA FIRUL APELANT, ASA CA FIECARE FIR ARE CONTOARELE LUI, DESCHISE LA PRIMUL SCOP
+// DACA NU POT FI DESCHISE (ALT SISTEM DE OPERARE, MASINA VIRTUALA FARA PMU, perf_event_paranoid PREA MARE), SE AFISEAZA UN AVERTISMENT O SINGURA DATA SI SCOPURILE NU MAI MASOARA NIMIC
+// CONTOARELE SUNT CITITE IMPREUNA, CA GRUP. DACA PROCESORUL NU ARE DESTULE REGISTRE, KERNEL-UL LE ALTERNEAZA SI VALORILE SUNT SCALATE
+class PerformanceCounters
 {
 public:
 
-	Component() {};
-	virtual ~Component() {};
+	static PerformanceCounters* Get()
+	{
+		thread_local PerformanceCounters performanceCounters;
 
-	Entity* entity = nullptr;
+		return &performanceCounters;
+	}
 
-private:
+	// COMUN TUTUROR FIRELOR. IMPLICIT DEZACTIVAT
+	static void SetEnabled(bool isEnabled)
+	{
+		PerformanceCounters::isEnabled.store(isEnabled, std::memory_order_relaxed);
+	}
 
-};
+	static bool IsEnabled()
+	{
+		return PerformanceCounters::isEnabled.load(std::memory_order_relaxed);
+	}
 
-// CLASA ENTITY
+	// ADEVARAT DACA MACAR UN CONTOR A PUTUT FI DESCHIS PE FIRUL CURENT
+	bool IsAvailable()
+	{
+		this->Open();
 
-class Entity
-{
-public:
+		return this->openCounters > 0;
+	}
 
-	Entity(EntityType entityType, bool isAnimated, bool isArtificialIntelligence) : entityType(entityType), isAnimated(isAnimated), isArtificialIntelligence(isArtificialIntelligence)
+	bool IsCounterAvailable(HardwareCounter counter)
 	{
-		for (int i = 0; i < MAX_COMPONENTS; i++)
-		{
-			this->componentBitset[i] = false;
-			this->componentList[i] = nullptr;
-		}
+		this->Open();
 
-		if (this->entityType == EntityType::character)
-		{
-			EntityManager::Get()->AddCharacter(this);
-		}
-		else if (this->entityType == EntityType::terrain)
-		{
-			EntityManager::Get()->AddTerrain(this);
-		}
-		else if (this->entityType == EntityType::bullet)
-		{
-			EntityManager::Get()->AddBullet(this);
-		}
+		return this->slots[(int)counter] != -1;
+	}
 
-		if (this->isAnimated)
+	// SCOPURILE NU SE IMBRICA: UN Begin FARA End E INLOCUIT DE URMATORUL
+	void Begin(EngineSystem system)
+	{
+		if (!PerformanceCounters::IsEnabled())
 		{
-			EntityManager::Get()->AddAnimatedEntity(this);
+			return;
 		}
 
-		if (this->isArtificialIntelligence)
+		this->Open();
+
+		if (this->openCounters == 0 || !this->Read(this->startValues))
 		{
-			EntityManager::Get()->AddArtificialIntelligence(this);
+			return;
 		}
+
+		this->currentSystem = (int)system;
 	}
 
-	virtual ~Entity()
+	void End(EngineSystem system)
 	{
-		for (int i = 0; i < MAX_COMPONENTS; i++)
+		if (this->currentSystem != (int)system)
 		{
-			delete this->componentList[i];
-			this->componentBitset[i] = false;
+			return;
 		}
 
-		if (entityType == EntityType::character)
-		{
-			EntityManager::Get()->RemoveCharacter(this);
-		}
-		else if (entityType == EntityType::terrain)
-		{
-			EntityManager::Get()->RemoveTerrain(this);
-		}
-		else if (entityType == EntityType::bullet)
+		this->currentSystem = -1;
+
+		std::array<std::uint64_t, PerformanceCounters::READ_SIZE> endValues;
+
+		if (!this->Read(endValues))
 		{
-			EntityManager::Get()->RemoveBullet(this);
+			return;
 		}
 
-		if (this->isAnimated)
+		// [0] = TIMPUL CAT GRUPUL A FOST ACTIV, [1] = TIMPUL CAT A FOST CHIAR NUMARAT
+		std::uint64_t enabledTime = endValues[0] - this->startValues[0];
+		std::uint64_t runningTime = endValues[1] - this->startValues[1];
+
+		if (runningTime == 0)
 		{
-			EntityManager::Get()->RemoveAnimatedEntity(this);
+			return;
 		}
 
-		if (this->isArtificialIntelligence)
+		double scale = (double)enabledTime / runningTime;
+
+		SystemCounters& counters = this->counters[(int)system];
+		counters.scopes++;
+
+		for (int i = 0; i < HARDWARE_COUNTER_COUNT; i++)
 		{
-			EntityManager::Get()->RemoveArtificialIntelligence(this);
+			if (this->slots[i] != -1)
+			{
+				std::uint64_t delta = endValues[2 + this->slots[i]] - this->startValues[2 + this->slots[i]];
+
+				counters.values[i] += runningTime < enabledTime ? (long long)(delta * scale) : (long long)delta;
+			}
 		}
 	}
 
-	template<typename T>
-	inline void AddComponent(T* component)
+	const SystemCounters& GetCounters(EngineSystem system)
 	{
-		this->componentBitset[GetComponentTypeID<T>()] = true;
-		this->componentList[GetComponentTypeID<T>()] = component;
-
-		component->entity = this;
+		return this->counters[(int)system];
 	}
 
-	template<typename T>
-	inline void DeleteComponent()
+	// VALORILE FIRULUI CURENT, DE LA ULTIMUL Reset
+	HardwareCounterReport GetReport()
 	{
-		if (this->componentBitset[GetComponentTypeID<T>()])
-		{
-			delete this->componentList[GetComponentTypeID<T>()];
+		HardwareCounterReport report;
 
-			this->componentBitset[GetComponentTypeID<T>()] = false;
-			this->componentList[GetComponentTypeID<T>()] = nullptr;
-		}
-		else
+		for (int i = 0; i < HARDWARE_COUNTER_COUNT; i++)
 		{
-			std::cout << "WARNING :: ENTITY :: DELETECOMPONENT :: COULD NOT DELETE A COMPONENT WHICH DID NOT EXIST IN THE FIRST PLACE\n";
+			report.isAvailable[i] = this->slots[i] != -1;
 		}
-	}
 
-	template<typename T>
-	inline T* GetComponent() const
-	{
-		if (!this->componentBitset[GetComponentTypeID<T>()])
-		{
-			std::cout << "WARNING :: ENTITY :: GETCOMPONENT :: UNCREATED COMPONENT WAS DEMANDED. RETURNING NULL POINTER...\n";
+		report.systems = this->counters;
 
-			return nullptr;
-		}
+		return report;
+	}
 
-		return static_cast<T*>(this->componentList[GetComponentTypeID<T>()]);
+	void Reset()
+	{
+		this->counters.fill(SystemCounters());
+		this->currentSystem = -1;
 	}
 
-	template<typename T>
-	inline bool HasComponent() const
+	static const char* GetSystemName(EngineSystem system)
 	{
+		const char* names[] = { "INPUT", "MOVEMENT", "COLLISION", "ANIMATION", "ARTIFICIAL INTELLIGENCE", "CAMERA", "SPATIAL ORDER", "SNAPSHOT", "RENDER" };
 
-		return this->componentBitset[GetComponentTypeID<T>()];
+		return names[(int)system];
 	}
 
-	EntityType GetEntityType()
+	static void PrintReport(const HardwareCounterReport& report)
 	{
-		return this->entityType;
-	}
+		if (!report.HasCounters())
+		{
+			std::cout << "COUNTERS :: HARDWARE COUNTERS ARE NOT AVAILABLE\n";
 
-private:
+			return;
+		}
 
-	EntityType entityType;
-	bool isAnimated;
-	bool isArtificialIntelligence;
+		const char* counterNames[] = { "CYCLES", "INSTRUCTIONS", "L1D MISSES", "LLC MISSES", "BRANCH MISSES" };
 
-	ComponentBitset componentBitset;
-	ComponentList componentList;
-};
+		for (int i = 0; i < ENGINE_SYSTEM_COUNT; i++)
+		{
+			const SystemCounters& counters = report.systems[i];
 
-// CLASELE COMPONENTELOR CE SE MOSTENESC DIN COMPONENTA DE BAZA, VIRTUALA
-// 2D
-class Position2D : public Component
-{
-public:
+			if (counters.scopes == 0)
+			{
+				continue;
+			}
 
-	Position2D(double x, double y) : x(x), y(y) {};
+			std::cout << "COUNTERS :: " << PerformanceCounters::GetSystemName((EngineSystem)i) << " :: SCOPES " << counters.scopes;
 
-	double x;
-	double y;
+			for (int j = 0; j < HARDWARE_COUNTER_COUNT; j++)
+			{
+				std::cout << " :: " << counterNames[j] << " ";
 
-private:
+				if (report.isAvailable[j])
+				{
+					std::cout << counters.GetPerScope((HardwareCounter)j);
+				}
+				else
+				{
+					std::cout << "N/A";
+				}
+			}
 
-};
+			if (report.isAvailable[(int)HardwareCounter::cycles] && report.isAvailable[(int)HardwareCounter::instructions])
+			{
+				std::cout << " :: IPC " << counters.GetInstructionsPerCycle();
+			}
 
-class Hitbox2D : public Component
-{
-public:
+			std::cout << " (PER SCOPE)\n";
+		}
+	}
 
-	Hitbox2D(double width, double height) : width(width), height(height)
+	~PerformanceCounters()
 	{
-		this->collidedDownward = false;/////////////////////////////////////////////////////////////////////////////////
+#ifdef GAMEENGINE_PERFORMANCE_COUNTERS
+		for (int i = 0; i < HARDWARE_COUNTER_COUNT; i++)
+		{
+			if (this->fds[i] != -1)
+			{
+				close(this->fds[i]);
+			}
+		}
+#endif
 	}
 
-	double width;
-	double height;
+private:
 
-	bool collidedDownward;////////////////////////////////////////////////////////////////////////////////////////////////
+	static std::atomic<bool> isEnabled;
 
-private:
+	// TIMPII [0], [1] SI CATE O VALOARE PENTRU FIECARE CONTOR DESCHIS
+	static const int READ_SIZE = 2 + HARDWARE_COUNTER_COUNT;
 
-};
+	bool isOpened = false;
 
-class Texture2D : public Component
-{
-public:
+	int groupFd = -1;
+	std::array<int, HARDWARE_COUNTER_COUNT> fds = { -1, -1, -1, -1, -1 };
+	std::array<int, HARDWARE_COUNTER_COUNT> slots = { -1, -1, -1, -1, -1 }; // POZITIA CONTORULUI IN CITIREA GRUPULUI, -1 DACA NU E DISPONIBIL
+	int openCounters = 0;
 
-	Texture2D() {};
+	std::array<std::uint64_t, PerformanceCounters::READ_SIZE> startValues = {};
+	int currentSystem = -1;
 
-	unsigned int currentTextureID = 0;
+	std::array<SystemCounters, ENGINE_SYSTEM_COUNT> counters;
 
-private:
+	// O SINGURA INCERCARE PE FIR
+	void Open()
+	{
+		if (this->isOpened)
+		{
+			return;
+		}
 
-};
+		this->isOpened = true;
 
-class TextureBox2D : public Component
-{
-public:
+		std::string reason = "NOT SUPPORTED ON THIS PLATFORM";
 
-	TextureBox2D(double width, double height) : width(width), height(height) {};
+#ifdef GAMEENGINE_PERFORMANCE_COUNTERS
+		const std::uint32_t types[] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE };
+		const std::uint64_t configs[] = {
+			PERF_COUNT_HW_CPU_CYCLES,
+			PERF_COUNT_HW_INSTRUCTIONS,
+			PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+			PERF_COUNT_HW_CACHE_MISSES, // PE PROCESOARELE UZUALE, RATARILE DIN ULTIMUL NIVEL DE CACHE
+			PERF_COUNT_HW_BRANCH_MISSES,
+		};
 
-	double width;
-	double height;
+		for (int i = 0; i < HARDWARE_COUNTER_COUNT; i++)
+		{
+			perf_event_attr attributes;
+			std::memset(&attributes, 0, sizeof(attributes));
 
-private:
+			attributes.size = sizeof(attributes);
+			attributes.type = types[i];
+			attributes.config = configs[i];
+			attributes.disabled = this->groupFd == -1 ? 1 : 0; // GRUPUL PORNESTE O DATA CU LIDERUL, DUPA CE TOTI MEMBRII SUNT DESCHISI
+			attributes.exclude_kernel = 1;
+			attributes.exclude_hv = 1;
+			attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
 
-};
+			// pid = 0, cpu = -1: FIRUL CURENT, PE ORICE PROCESOR
+			int fd = (int)syscall(__NR_perf_event_open, &attributes, 0, -1, this->groupFd, 0);
 
-class Render2D : public Component
-{
-public:
+			if (fd == -1)
+			{
+				reason = std::string("perf_event_open FAILED: ") + std::strerror(errno);
 
-	Render2D() {};
+				continue;
+			}
 
-	void Render(Renderer2D* renderer2D)
-	{
-		if (!this->entity->HasComponent<Position2D>())
-		{
-			std::cout << "ERROR :: RENDER2DCOMPONENT :: THERE IS NO POSITION2D COMPONENT FOR ENTITY. RETURNING WITHOUT RENDERING...\n";
+			if (this->groupFd == -1)
+			{
+				this->groupFd = fd;
+			}
 
-			return;
+			this->fds[i] = fd;
+			this->slots[i] = this->openCounters++;
 		}
-		if (!this->entity->HasComponent<TextureBox2D>())
-		{
-			std::cout << "ERROR :: RENDER2DCOMPONENT :: THERE IS NO TEXTUREBOX2D COMPONENT FOR ENTITY. RETURNING WITHOUT RENDERING...\n";
 
-			return;
-		}
-		if (!this->entity->HasComponent<Texture2D>())
+		if (this->groupFd != -1)
 		{
-			std::cout << "ERROR :: RENDER2DCOMPONENT :: THERE IS NO TEXTURE2D COMPONENT FOR ENTITY. RETURNING WITHOUT RENDERING...\n";
+			ioctl(this->groupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+			ioctl(this->groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
 
 			return;
 		}
+#endif
 
-		if (this->entity->GetComponent<Texture2D>()->currentTextureID == 0)
-		{
-			std::cout << "WARNING :: RENDER2DCOMPONENT :: THERE IS NO TEXTURE TO USE FOR RENDERING. SELECTING THE ERROR TEXTURE INSTEAD AND ATTEMPTING RENDERING...\n";
+		static std::atomic<bool> hasWarned(false);
 
-			entity->GetComponent<Texture2D>()->currentTextureID = AssetManager::Get()->GetErrorTextureID();
+		if (!hasWarned.exchange(true))
+		{
+			std::cout << "WARNING :: PERFORMANCE COUNTERS :: OPEN :: HARDWARE COUNTERS ARE NOT AVAILABLE (" << reason << "). SCOPES WILL NOT BE MEASURED\n";
 		}
+	}
 
-		data.clear();
+	bool Read(std::array<std::uint64_t, PerformanceCounters::READ_SIZE>& values)
+	{
+#ifdef GAMEENGINE_PERFORMANCE_COUNTERS
+		// FORMATUL CITIRII DE GRUP: NUMARUL DE CONTOARE, TIMPII, APOI VALORILE IN ORDINEA DESCHIDERII
+		std::uint64_t buffer[1 + PerformanceCounters::READ_SIZE];
 
-		// TEXTURILE AU ORIGINEA O(0, 0) IN COLTUL DE SUS DIN STANGA
+		std::size_t expectedSize = sizeof(std::uint64_t) * (3 + this->openCounters);
 
-		/*
-		6-------3/4
-		|        |
-		|        |
-		|        |
-		1/5------2
-		*/
+		if (read(this->groupFd, buffer, expectedSize) != (ssize_t)expectedSize)
+		{
+			return false;
+		}
 
-		if (!Player::Get()->ShouldCameraFollowPlayer())
+		for (int i = 0; i < 2 + this->openCounters; i++)
 		{
-			data.push_back(entity->GetComponent<Position2D>()->x - entity->GetComponent<TextureBox2D>()->width / 2.0);
-			data.push_back(entity->GetComponent<Position2D>()->y - entity->GetComponent<TextureBox2D>()->height / 2.0);
+			values[i] = buffer[1 + i];
+		}
 
-			data.push_back(0.0);
-			data.push_back(1.0);
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	PerformanceCounters() {};
 
-			data.push_back(entity->GetComponent<Position2D>()->x + entity->GetComponent<TextureBox2D>()->width / 2.0);
-			data.push_back(entity->GetComponent<Position2D>()->y - entity->GetComponent<TextureBox2D>()->height / 2.0);
+	PerformanceCounters(const PerformanceCounters&) = delete;
+};
 
-			data.push_back(1.0);
-			data.push_back(1.0);
+std::atomic<bool> PerformanceCounters::isEnabled(false);
 
-			data.push_back(entity->GetComponent<Position2D>()->x + entity->GetComponent<TextureBox2D>()->width / 2.0);
-			data.push_back(entity->GetComponent<Position2D>()->y + entity->GetComponent<TextureBox2D>()->height / 2.0);
+// ATRIBUIE SISTEMULUI system CONTOARELE DINTRE CONSTRUCTIE SI DISTRUGERE. NU COSTA NIMIC CAT TIMP PerformanceCounters E DEZACTIVAT
+class PerformanceCounterScope
+{
+public:
 
-			data.push_back(1.0);
-			data.push_back(0.0);
+	PerformanceCounterScope(EngineSystem system)
+	{
+		this->system = system;
+		this->isMeasuring = PerformanceCounters::IsEnabled();
 
-			data.push_back(entity->GetComponent<Position2D>()->x + entity->GetComponent<TextureBox2D>()->width / 2.0);
-			data.push_back(entity->GetComponent<Position2D>()->y + entity->GetComponent<TextureBox2D>()->height / 2.0);
+		if (this->isMeasuring)
+		{
+			PerformanceCounters::Get()->Begin(system);
+		}
+	}
 
-			data.push_back(1.0);
-			data.push_back(0.0);
+	~PerformanceCounterScope()
+	{
+		if (this->isMeasuring)
+		{
+			PerformanceCounters::Get()->End(this->system);
+		}
+	}
 
-			data.push_back(entity->GetComponent<Position2D>()->x - entity->GetComponent<TextureBox2D>()->width / 2.0);
-			data.push_back(entity->GetComponent<Position2D>()->y - entity->GetComponent<TextureBox2D>()->height / 2.0);
+private:
 
-			data.push_back(0.0);
-			data.push_back(1.0);
+	EngineSystem system;
+	bool isMeasuring;
 
-			data.push_back(entity->GetComponent<Position2D>()->x - entity->GetComponent<TextureBox2D>()->width / 2.0);
-			data.push_back(entity->GetComponent<Position2D>()->y + entity->GetComponent<TextureBox2D>()->height / 2.0);
+	PerformanceCounterScope(const PerformanceCounterScope&) = delete;
+};
 
-			data.push_back(0.0);
-			data.push_back(0.0);
+// CLASA WORLD
 
-			renderer2D->StartUsing();
+// O LUME DE SIMULARE INDEPENDENTA: ENTITATILE, COMPONENTELE, CEASUL, JUCATORUL SI SISTEMELE EI. Get()-UL FIECARUI SISTEM INTOARCE
+// INSTANTA DIN LUMEA CURENTA A FIRULUI DE EXECUTIE, IAR DACA FIRUL NU A ALES NICIO LUME, PE CEA IMPLICITA (CA INAINTE, CU SINGLETON-URI)
+// MAI MULTE LUMI POT FI SIMULATE IN PARALEL PE FIRE DIFERITE, CAT TIMP FIECARE E FOLOSITA DE UN SINGUR FIR ODATA
+// FEREASTRA SI ASSET-URILE (WindowManager, AssetManager) RAMAN COMUNE TUTUROR LUMILOR
+class World
+{
+public:
 
-			glBindVertexArray(renderer2D->GetVAOID());
-			glBindBuffer(GL_ARRAY_BUFFER, renderer2D->GetVBOID());
+	// DACA arena E DATA, BLOCURILE DE COMPONENTE SI CADRELE CORUTINELOR LUMII SE IAU DIN EA (ARENA TREBUIE SA TRAIASCA MAI MULT DECAT LUMEA)
+	World(MemoryArena* arena = nullptr) : arena(arena) {};
 
-			glBindTexture(GL_TEXTURE_2D, entity->GetComponent<Texture2D>()->currentTextureID);
+	// STERGE ENTITATILE INREGISTRATE IN EntityManager SI TOATE SISTEMELE LUMII (DEFINIT LA SFARSITUL FISIERULUI)
+	~World();
 
-			glBufferData(GL_ARRAY_BUFFER, sizeof(double) * data.size(), &data[0], GL_DYNAMIC_DRAW);
+	static World* GetDefault()
+	{
+		World*& defaultWorld = World::GetDefaultSlot();
 
-			glDrawArrays(GL_TRIANGLES, 0, data.size() / 4);
-		}
-		else if (Player::Get()->GetEntity() != nullptr && Player::Get()->GetEntity()->HasComponent<Position2D>())
+		// DOAR DUPA DestroyDefault
+		if (defaultWorld == nullptr)
 		{
-			data.push_back(entity->GetComponent<Position2D>()->x - entity->GetComponent<TextureBox2D>()->width / 2.0 - Player::Get()->GetEntity()->GetComponent<Position2D>()->x + WindowManager::Get()->GetWindowWidth() / 2.0);
-			data.push_back(entity->GetComponent<Position2D>()->y - entity->GetComponent<TextureBox2D>()->height / 2.0 - Player::Get()->GetEntity()->GetComponent<Position2D>()->y + WindowManager::Get()->GetWindowHeight() / 2.0);
+			defaultWorld = new World();
+		}
 
-			data.push_back(0.0);
-			data.push_back(1.0);
+		return defaultWorld;
+	}
+
+	// STERGE LUMEA IMPLICITA, LA IESIREA DIN JOC (CAT TIMP FEREASTRA SI CONTEXTUL OpenGL INCA EXISTA, CA SA POATA FI ELIBERATE BUFFERELE COZII DE RANDARE)
+	// NICIUN ALT FIR NU TREBUIE SA MAI FOLOSEASCA LUMEA IMPLICITA. UN Get() ULTERIOR CREEAZA O LUME IMPLICITA NOUA
+	static void DestroyDefault()
+	{
+		World*& defaultWorld = World::GetDefaultSlot();
 
-			data.push_back(entity->GetComponent<Position2D>()->x + entity->GetComponent<TextureBox2D>()->width / 2.0 - Player::Get()->GetEntity()->GetComponent<Position2D>()->x + WindowManager::Get()->GetWindowWidth() / 2.0);
-			data.push_back(entity->GetComponent<Position2D>()->y - entity->GetComponent<TextureBox2D>()->height / 2.0 - Player::Get()->GetEntity()->GetComponent<Position2D>()->y + WindowManager::Get()->GetWindowHeight() / 2.0);
+		if (defaultWorld == nullptr)
+		{
+			return;
+		}
 
-			data.push_back(1.0);
-			data.push_back(1.0);
+		World* world = defaultWorld;
 
-			data.push_back(entity->GetComponent<Position2D>()->x + entity->GetComponent<TextureBox2D>()->width / 2.0 - Player::Get()->GetEntity()->GetComponent<Position2D>()->x + WindowManager::Get()->GetWindowWidth() / 2.0);
-			data.push_back(entity->GetComponent<Position2D>()->y + entity->GetComponent<TextureBox2D>()->height / 2.0 - Player::Get()->GetEntity()->GetComponent<Position2D>()->y + WindowManager::Get()->GetWindowHeight() / 2.0);
+		delete world;
+		defaultWorld = nullptr;
 
-			data.push_back(1.0);
-			data.push_back(0.0);
+		// WorldScope-UL DIN DESTRUCTOR A REPUS-O CA LUME CURENTA, DACA FIRUL NU ALESESE ALTA
+		if (World::currentWorld == world)
+		{
+			World::currentWorld = nullptr;
+		}
+	}
 
-			data.push_back(entity->GetComponent<Position2D>()->x + entity->GetComponent<TextureBox2D>()->width / 2.0 - Player::Get()->GetEntity()->GetComponent<Position2D>()->x + WindowManager::Get()->GetWindowWidth() / 2.0);
-			data.push_back(entity->GetComponent<Position2D>()->y + entity->GetComponent<TextureBox2D>()->height / 2.0 - Player::Get()->GetEntity()->GetComponent<Position2D>()->y + WindowManager::Get()->GetWindowHeight() / 2.0);
+	static World* GetCurrent()
+	{
+		if (World::currentWorld == nullptr)
+		{
+			return World::GetDefault();
+		}
 
-			data.push_back(1.0);
-			data.push_back(0.0);
+		return World::currentWorld;
+	}
 
-			data.push_back(entity->GetComponent<Position2D>()->x - entity->GetComponent<TextureBox2D>()->width / 2.0 - Player::Get()->GetEntity()->GetComponent<Position2D>()->x + WindowManager::Get()->GetWindowWidth() / 2.0);
-			data.push_back(entity->GetComponent<Position2D>()->y - entity->GetComponent<TextureBox2D>()->height / 2.0 - Player::Get()->GetEntity()->GetComponent<Position2D>()->y + WindowManager::Get()->GetWindowHeight() / 2.0);
+	// LUMEA FOLOSITA DE FIRUL CURENT (nullptr REVINE LA CEA IMPLICITA)
+	static void SetCurrent(World* world)
+	{
+		World::currentWorld = world;
+	}
 
-			data.push_back(0.0);
-			data.push_back(1.0);
+	void MakeCurrent()
+	{
+		World::SetCurrent(this);
+	}
 
-			data.push_back(entity->GetComponent<Position2D>()->x - entity->GetComponent<TextureBox2D>()->width / 2.0 - Player::Get()->GetEntity()->GetComponent<Position2D>()->x + WindowManager::Get()->GetWindowWidth() / 2.0);
-			data.push_back(entity->GetComponent<Position2D>()->y + entity->GetComponent<TextureBox2D>()->height / 2.0 - Player::Get()->GetEntity()->GetComponent<Position2D>()->y + WindowManager::Get()->GetWindowHeight() / 2.0);
+	MemoryArena* GetArena()
+	{
+		return this->arena;
+	}
 
-			data.push_back(0.0);
-			data.push_back(0.0);
+	// SISTEMELE, CREATE LA PRIMA FOLOSIRE DE Get()-UL FIECARUIA
+	TimeManager* timeManager = nullptr;
+	Player* player = nullptr;
+	EntityManager* entityManager = nullptr;
+	EntityPool* entityPool = nullptr;
+	ComponentStorageManager* componentStorageManager = nullptr;
+	UserInputManager* userInputManager = nullptr;
+	MovementManager* movementManager = nullptr;
+	CollisionManager* collisionManager = nullptr;
+	AnimationManager* animationManager = nullptr;
+	FlowFieldManager* flowFieldManager = nullptr;
+	ArtificialIntelligenceManager* artificialIntelligenceManager = nullptr;
+	ReplayManager* replayManager = nullptr;
+	SnapshotManager* snapshotManager = nullptr;
+	RenderQueue* renderQueue = nullptr;
+	CameraManager* cameraManager = nullptr;
+	SpatialOrderManager* spatialOrderManager = nullptr;
+	GameEngine* gameEngine = nullptr;
+#ifdef GAMEENGINE_COROUTINES
+	BehaviorFramePool* behaviorFramePool = nullptr;
+#endif
 
-			renderer2D->StartUsing();
+private:
 
-			glBindVertexArray(renderer2D->GetVAOID());
-			glBindBuffer(GL_ARRAY_BUFFER, renderer2D->GetVBOID());
+	static thread_local World* currentWorld;
 
-			glBindTexture(GL_TEXTURE_2D, entity->GetComponent<Texture2D>()->currentTextureID);
+	MemoryArena* arena;
 
-			glBufferData(GL_ARRAY_BUFFER, sizeof(double) * data.size(), &data[0], GL_DYNAMIC_DRAW);
+	static World*& GetDefaultSlot()
+	{
+		// STATIC LOCAL, CA INITIALIZAREA SA FIE SIGURA SI CAND MAI MULTE FIRE O CER DEODATA
+		static World* defaultWorld = new World();
 
-			glDrawArrays(GL_TRIANGLES, 0, data.size() / 4);
-		}
+		return defaultWorld;
 	}
 
-private:
+	World(const World&) = delete;
+};
 
-	std::vector<double> data;
+thread_local World* World::currentWorld = nullptr;
 
-};
+inline MetricsRegistry::MetricsShard* MetricsRegistry::GetShard()
+{
+	thread_local MetricsShardOwner owner;
+
+	return owner.shards[World::GetCurrent() == World::GetDefault() ? (int)MetricsSource::defaultWorld : (int)MetricsSource::otherWorlds];
+}
 
-class Speed2D : public Component
+// FACE O LUME CURENTA PE DURATA UNUI BLOC SI O REPUNE PE CEA DE DINAINTE LA IESIRE
+class WorldScope
 {
 public:
 
-	Speed2D(double speedX = 0.0, double speedY = 0.0) : speedX(speedX), speedY(speedY) {};
+	WorldScope(World* world) : previousWorld(World::GetCurrent())
+	{
+		World::SetCurrent(world);
+	}
 
-	double speedX;
-	double speedY;
+	~WorldScope()
+	{
+		World::SetCurrent(this->previousWorld);
+	}
 
 private:
 
+	World* previousWorld;
+
+	WorldScope(const WorldScope&) = delete;
 };
 
-class Acceleration2D : public Component
+// FIRUL PRINCIPAL, CEL CARE INITIALIZEAZA VARIABILELE GLOBALE INAINTE DE main. FEREASTRA, RANDAREA (RenderBackend, RenderStateCache)
+// SI INPUT-UL DIN FEREASTRA AU STARE COMUNA TUTUROR LUMILOR, FARA SINCRONIZARE, DECI SUNT FOLOSITE DOAR DE PE EL (GLFW CERE ORICUM ASTA)
+const std::thread::id MAIN_THREAD_ID = std::this_thread::get_id();
+
+inline bool IsMainThread()
+{
+	return std::this_thread::get_id() == MAIN_THREAD_ID;
+}
+
+// CLASA WINDOW MANAGER
+
+class WindowManager
 {
 public:
 
-	Acceleration2D(double accelerationX = 0.0, double accelerationY = 0.0) : accelerationX(accelerationX), accelerationY(accelerationY) {};
+	static WindowManager* Get()
+	{
+		if (WindowManager::instance == nullptr)
+		{
+			WindowManager::instance = new WindowManager();
+		}
 
-	double accelerationX;
-	double accelerationY;
+		return WindowManager::instance;
+	}
 
-private:
+	void CreateWindow(int windowWidth, int windowHeight, std::string windowTitle)
+	{
+		this->windowWidth = windowWidth;
+		this->windowHeight = windowHeight;
+		this->windowTitle = windowTitle;
 
-};
+		glfwInit();
 
-class Gravity2D : public Component
-{
-public:
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
-	Gravity2D(double value = 10.0) : value(value) {};
+		this->window = glfwCreateWindow(this->windowWidth, this->windowHeight, this->windowTitle.c_str(), NULL, NULL);
+		//glfwGetPrimaryMonitor();
 
-	double value;
+		glfwMakeContextCurrent(this->window);
 
-private:
+		glfwSetInputMode(this->window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 
-};
+		glewInit();
 
-class Animation2D : public Component
-{
-public:
+		glfwSwapInterval(1);
+	}
 
-	Animation2D(double frameTime = 0.1) : frameTime(frameTime)
+	void UpdateWindow()
 	{
-		this->currentEntityAnimation = EntityAnimation::null;
+		glfwSwapBuffers(this->window);
 
-		this->lastEntityAnimation = EntityAnimation::null;
+		glfwPollEvents();
 
-		this->timeWhenCurrentTextureSelected = 0.0;
+		glClear(GL_COLOR_BUFFER_BIT);
 	}
 
-	std::vector<unsigned int> animations[MAX_ANIMATIONS_ENTITY];
+	void DestroyWindow()
+	{
+		glfwSetWindowShouldClose(this->window, true);
 
-	int animationIndex = 0;
+		glfwDestroyWindow(this->window);
 
-	EntityAnimation currentEntityAnimation;
-	EntityAnimation lastEntityAnimation;
+		this->window = nullptr;
+	}
 
-	double frameTime;
-	double timeWhenCurrentTextureSelected;
+	void SetWindowShouldClose(bool state)
+	{
+		glfwSetWindowShouldClose(this->window, state);
+	}
 
-private:
+	void SetClearColor(double red, double green, double blue)
+	{
+		glClearColor(red, green, blue, 1.0);
+	}
 
-};
+	void SetClearColor(double red, double green, double blue, double alpha)
+	{
+		glClearColor(red, green, blue, alpha);
+	}
 
-class MovementSpeed2D : public Component
-{
-public:
+	bool ShouldWindowClose()
+	{
+		return glfwWindowShouldClose(this->window);
+	}
 
-	MovementSpeed2D(double speedX = 0.0, double speedY = 0.0) : speedX(speedX), speedY(speedY)
+	GLFWwindow* GetWindow()
 	{
-		this->wentRight = false;
-		this->wentLeft = false;
+		return this->window;
 	}
 
-	double speedX;
-	double speedY;
+	int GetWindowWidth()
+	{
+		return this->windowWidth;
+	}
 
-	bool wentRight;
-	bool wentLeft;
+	int GetWindowHeight()
+	{
+		return this->windowHeight;
+	}
 
 private:
 
-};
+	static WindowManager* instance;
 
-class ArtificialIntelligence2D : public Component
-{
-public:
+	int windowWidth = 1024;
+	int windowHeight = 768;
 
-	ArtificialIntelligence2D(ArtificialIntelligence state) : state(state) {};
+	std::string windowTitle = "GameEngine";
 
-	ArtificialIntelligence state;
+	GLFWwindow* window = nullptr;
 
-private:
+	WindowManager() {};
 
+	WindowManager(const WindowManager&) = delete;
 };
 
-// CLASA USER INPUT MANAGER
+WindowManager* WindowManager::instance = nullptr;
 
-class UserInputManager
+// CLASA TIME MANAGER
+
+class TimeManager
 {
 public:
 
-	static UserInputManager* Get()
+	static TimeManager* Get()
 	{
-		if (UserInputManager::instance == nullptr)
+		World* world = World::GetCurrent();
+
+		if (world->timeManager == nullptr)
 		{
-			UserInputManager::instance = new UserInputManager();
+			world->timeManager = new TimeManager();
 		}
 
-		return UserInputManager::instance;
+		return world->timeManager;
 	}
 
-	void ListenForInput()
+	void UpdateDeltaTime()
 	{
-		if (glfwGetKey(WindowManager::Get()->GetWindow(), GLFW_KEY_ESCAPE) == GLFW_PRESS)
-		{
-			this->gameEngineShouldStop = true;
-		}
-
-		if (Player::Get()->GetEntity() == nullptr)
-		{
-			std::cout << "WARNING :: USERINPUTMANAGER :: LISTENFORINPUT :: PLAYER ENTITY HAS NOT BEEN SET YET\n";
-
-			return;
-		}
-
-		if (Player::Get()->GetEntity()->HasComponent<Speed2D>() && Player::Get()->GetEntity()->HasComponent<MovementSpeed2D>())
-		{
-
-			if (glfwGetKey(WindowManager::Get()->GetWindow(), GLFW_KEY_D) == GLFW_PRESS)
-			{
-				if (!Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentRight)
-				{
-					Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentRight = true;
-
-					Player::Get()->GetEntity()->GetComponent<Speed2D>()->speedX += Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->speedX;
-				}
-			}
-			else if (Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentRight)
-			{
-				Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentRight = false;
+		this->previousTime = this->currentTime;
+		this->currentTime = glfwGetTime();
+		this->deltaTime = this->currentTime - this->previousTime;
+	}
 
-				Player::Get()->GetEntity()->GetComponent<Speed2D>()->speedX -= Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->speedX;
-			}
+	void SetDeltaTime(double deltaTime) // AVANSEAZA TIMPUL CU O VALOARE DATA IN LOC DE CEASUL REAL (FOLOSIT LA REPLAY)
+	{
+		this->previousTime = this->currentTime;
+		this->currentTime += deltaTime;
+		this->deltaTime = deltaTime;
+	}
 
-			if (glfwGetKey(WindowManager::Get()->GetWindow(), GLFW_KEY_A) == GLFW_PRESS)
-			{
-				if (!Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentLeft)
-				{
-					Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentLeft = true;
+	void SetCurrentTime(double currentTime)
+	{
+		this->currentTime = currentTime;
+		this->previousTime = currentTime;
+		this->deltaTime = 0.0;
+	}
 
-					Player::Get()->GetEntity()->GetComponent<Speed2D>()->speedX -= Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->speedX;
-				}
-			}
-			else if (Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentLeft)
-			{
-				Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentLeft = false;
+	double GetDeltaTime()
+	{
+		return this->deltaTime;
+	}
 
-				Player::Get()->GetEntity()->GetComponent<Speed2D>()->speedX += Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->speedX;
-			}
+	double GetCurrentTime()
+	{
+		return this->currentTime;
+	}
 
-			if (glfwGetKey(WindowManager::Get()->GetWindow(), GLFW_KEY_SPACE) == GLFW_PRESS)
-			{
-				if (Player::Get()->GetEntity()->HasComponent<Hitbox2D>())
-				{
-					if (Player::Get()->GetEntity()->GetComponent<Hitbox2D>()->collidedDownward)
-					{
-						Player::Get()->GetEntity()->GetComponent<Hitbox2D>()->collidedDownward = false;
+	// TOT CEASUL, CA SA POATA FI PUS LA LOC DUPA O SIMULARE CU ALT TIMP (GameEngine::Replay)
+	struct State
+	{
+		double deltaTime;
+		double currentTime;
+		double previousTime;
+	};
 
-						Player::Get()->GetEntity()->GetComponent<Speed2D>()->speedY += Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->speedY;
-					}
-				}
-			}
-		}
+	State GetState()
+	{
+		return { this->deltaTime, this->currentTime, this->previousTime };
 	}
 
-	bool ShouldGameEngineStop()
+	void SetState(const State& state)
 	{
-		return this->gameEngineShouldStop;
+		this->deltaTime = state.deltaTime;
+		this->currentTime = state.currentTime;
+		this->previousTime = state.previousTime;
 	}
 
 private:
 
-	static UserInputManager* instance;
+	double deltaTime = 0.0;
 
-	bool gameEngineShouldStop;
+	double currentTime = 0.0;
+	double previousTime = 0.0;
 
-	UserInputManager()
-	{
-		this->gameEngineShouldStop = false;
-	}
+	TimeManager() {};
 
-	UserInputManager(const UserInputManager&) = delete;
+	TimeManager(const TimeManager&) = delete;
 };
 
-UserInputManager* UserInputManager::instance = nullptr;
-
-// CLASA MOVEMENT MANAGER
+// CLASA SINGLETON PLAYER
 
-class MovementManager
+class Player
 {
 public:
 
-	static MovementManager* Get()
+	static Player* Get()
 	{
-		if (MovementManager::instance == nullptr)
+		World* world = World::GetCurrent();
+
+		if (world->player == nullptr)
 		{
-			MovementManager::instance = new MovementManager();
+			world->player = new Player();
 		}
 
-		return MovementManager::instance;
+		return world->player;
 	}
 
-	void UpdateMovements()
+	void SetEntity(Entity* entity)
 	{
-		for (int i = 0; i < EntityManager::Get()->characters.size(); i++)
-		{
-			if (EntityManager::Get()->characters[i]->HasComponent<Speed2D>())
-			{
-				if (EntityManager::Get()->characters[i]->HasComponent<Gravity2D>())
-				{
-					EntityManager::Get()->characters[i]->GetComponent<Speed2D>()->speedY += EntityManager::Get()->characters[i]->GetComponent<Gravity2D>()->value * TimeManager::Get()->GetDeltaTime();
-				}
-				if (EntityManager::Get()->characters[i]->HasComponent<Acceleration2D>())
-				{
-					EntityManager::Get()->characters[i]->GetComponent<Speed2D>()->speedX += EntityManager::Get()->characters[i]->GetComponent<Acceleration2D>()->accelerationX * TimeManager::Get()->GetDeltaTime();
-					EntityManager::Get()->characters[i]->GetComponent<Speed2D>()->speedY += EntityManager::Get()->characters[i]->GetComponent<Acceleration2D>()->accelerationY * TimeManager::Get()->GetDeltaTime();
-				}
-
-				if (EntityManager::Get()->characters[i]->HasComponent<Position2D>())
-				{
-
-					EntityManager::Get()->characters[i]->GetComponent<Position2D>()->x += EntityManager::Get()->characters[i]->GetComponent<Speed2D>()->speedX * TimeManager::Get()->GetDeltaTime();
-					EntityManager::Get()->characters[i]->GetComponent<Position2D>()->y += EntityManager::Get()->characters[i]->GetComponent<Speed2D>()->speedY * TimeManager::Get()->GetDeltaTime();
-				}
-			}
-		}
-
-		for (int i = 0; i < EntityManager::Get()->terrains.size(); i++)
-		{
-			if (EntityManager::Get()->terrains[i]->HasComponent<Speed2D>())
-			{
-				if (EntityManager::Get()->terrains[i]->HasComponent<Position2D>())
-				{
-
-					EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->x += EntityManager::Get()->terrains[i]->GetComponent<Speed2D>()->speedX * TimeManager::Get()->GetDeltaTime();
-					EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->y += EntityManager::Get()->terrains[i]->GetComponent<Speed2D>()->speedY * TimeManager::Get()->GetDeltaTime();
-				}
-
-				if (EntityManager::Get()->terrains[i]->HasComponent<Gravity2D>())
-				{
-					EntityManager::Get()->terrains[i]->GetComponent<Speed2D>()->speedY += EntityManager::Get()->terrains[i]->GetComponent<Gravity2D>()->value * TimeManager::Get()->GetDeltaTime();
-				}
-				if (EntityManager::Get()->terrains[i]->HasComponent<Acceleration2D>())
-				{
-					EntityManager::Get()->terrains[i]->GetComponent<Speed2D>()->speedX += EntityManager::Get()->terrains[i]->GetComponent<Acceleration2D>()->accelerationX * TimeManager::Get()->GetDeltaTime();
-					EntityManager::Get()->terrains[i]->GetComponent<Speed2D>()->speedY += EntityManager::Get()->terrains[i]->GetComponent<Acceleration2D>()->accelerationY * TimeManager::Get()->GetDeltaTime();
-				}
-			}
-		}
+		this->entity = entity;
+	}
 
-		for (int i = 0; i < EntityManager::Get()->bullets.size(); i++)
-		{
-			if (EntityManager::Get()->bullets[i]->HasComponent<Speed2D>())
-			{
-				if (EntityManager::Get()->bullets[i]->HasComponent<Position2D>())
-				{
+	Entity* GetEntity()
+	{
+		return this->entity;
+	}
 
-					EntityManager::Get()->bullets[i]->GetComponent<Position2D>()->x += EntityManager::Get()->bullets[i]->GetComponent<Speed2D>()->speedX * TimeManager::Get()->GetDeltaTime();
-					EntityManager::Get()->bullets[i]->GetComponent<Position2D>()->y += EntityManager::Get()->bullets[i]->GetComponent<Speed2D>()->speedY * TimeManager::Get()->GetDeltaTime();
-				}
+	void SetCameraShouldFollowPlayer(bool state)
+	{
+		this->cameraFollowsPlayer = state;
+	}
 
-				if (EntityManager::Get()->bullets[i]->HasComponent<Gravity2D>())
-				{
-					EntityManager::Get()->bullets[i]->GetComponent<Speed2D>()->speedY += EntityManager::Get()->bullets[i]->GetComponent<Gravity2D>()->value * TimeManager::Get()->GetDeltaTime();
-				}
-				if (EntityManager::Get()->bullets[i]->HasComponent<Acceleration2D>())
-				{
-					EntityManager::Get()->bullets[i]->GetComponent<Speed2D>()->speedX += EntityManager::Get()->bullets[i]->GetComponent<Acceleration2D>()->accelerationX * TimeManager::Get()->GetDeltaTime();
-					EntityManager::Get()->bullets[i]->GetComponent<Speed2D>()->speedY += EntityManager::Get()->bullets[i]->GetComponent<Acceleration2D>()->accelerationY * TimeManager::Get()->GetDeltaTime();
-				}
-			}
-		}
+	bool ShouldCameraFollowPlayer()
+	{
+		return this->cameraFollowsPlayer;
 	}
 
 private:
 
-	static MovementManager* instance;
+	Entity* entity;
 
-	MovementManager() {};
+	bool cameraFollowsPlayer;
 
-	MovementManager(const MovementManager&) = delete;
+	Player()
+	{
+		this->entity = nullptr;
 
-};
+		this->cameraFollowsPlayer = false;
+	}
 
-MovementManager* MovementManager::instance = nullptr;
+	Player(const Player&) = delete;
+};
 
-// CLASA COLLISION MANAGER
+// CLASA SPATIAL GRID
 
-class CollisionManager
+// GRID UNIFORM (HASH DUPA CELULA) PENTRU CAUTARI DUPA POZITIE. CELULELE GOALE NU OCUPA MEMORIE
+class SpatialGrid
 {
 public:
 
-	static CollisionManager* Get()
+	SpatialGrid(double cellSize = 256.0) : cellSize(cellSize) {};
+
+	void SetCellSize(double cellSize)
 	{
-		if (CollisionManager::instance == nullptr)
-		{
-			CollisionManager::instance = new CollisionManager();
-		}
+		this->cellSize = cellSize;
 
-		return CollisionManager::instance;
+		this->Clear();
 	}
 
-	void UpdateCollisions()
+	double GetCellSize()
 	{
-		for (int i = 0; i < EntityManager::Get()->characters.size(); i++)
-		{
-
-			if (!EntityManager::Get()->characters[i]->HasComponent<Position2D>() || !EntityManager::Get()->characters[i]->HasComponent<Hitbox2D>()) continue;
+		return this->cellSize;
+	}
 
-			for (int j = 0; j < EntityManager::Get()->bullets.size(); j++)
-			{
-				if (!EntityManager::Get()->bullets[j]->HasComponent<Position2D>() || !EntityManager::Get()->bullets[j]->HasComponent<Hitbox2D>()) continue;
+	// INSEREAZA ENTITATEA SAU O MUTA IN CELULA NOUA DACA ERA DEJA IN GRID
+	void Update(Entity* entity, double x, double y)
+	{
+		long long cell = this->GetCellKey(this->GetCellCoordinate(x), this->GetCellCoordinate(y));
 
-				if (std::max(EntityManager::Get()->characters[i]->GetComponent<Position2D>()->x - EntityManager::Get()->characters[i]->GetComponent<Hitbox2D>()->width / 2.0, EntityManager::Get()->bullets[j]->GetComponent<Position2D>()->x - EntityManager::Get()->bullets[j]->GetComponent<Hitbox2D>()->width / 2.0) <=
-					std::min(EntityManager::Get()->characters[i]->GetComponent<Position2D>()->x + EntityManager::Get()->characters[i]->GetComponent<Hitbox2D>()->width / 2.0, EntityManager::Get()->bullets[j]->GetComponent<Position2D>()->x + EntityManager::Get()->bullets[j]->GetComponent<Hitbox2D>()->width / 2.0) &&
-					std::max(EntityManager::Get()->characters[i]->GetComponent<Position2D>()->y - EntityManager::Get()->characters[i]->GetComponent<Hitbox2D>()->height / 2.0, EntityManager::Get()->bullets[j]->GetComponent<Position2D>()->y - EntityManager::Get()->bullets[j]->GetComponent<Hitbox2D>()->height / 2.0) <=
-					std::min(EntityManager::Get()->characters[i]->GetComponent<Position2D>()->y + EntityManager::Get()->characters[i]->GetComponent<Hitbox2D>()->height / 2.0, EntityManager::Get()->bullets[j]->GetComponent<Position2D>()->y + EntityManager::Get()->bullets[j]->GetComponent<Hitbox2D>()->height / 2.0))
-				{
-					EntityManager::Get()->RemoveBullet(j);
-					j--;
-				}
-			}
-		}
+		std::unordered_map<Entity*, long long>::iterator it = this->entityCells.find(entity);
 
-		for (int i = 0; i < EntityManager::Get()->characters.size(); i++)
+		if (it != this->entityCells.end())
 		{
-			if (EntityManager::Get()->characters[i]->HasComponent<Hitbox2D>())
+			if (it->second == cell)
 			{
-				EntityManager::Get()->characters[i]->GetComponent<Hitbox2D>()->collidedDownward = false;
+				return;
 			}
+
+			this->RemoveFromCell(entity, it->second);
+			it->second = cell;
+		}
+		else
+		{
+			this->entityCells.insert({ entity, cell });
 		}
 
-		for (int i = 0; i < EntityManager::Get()->terrains.size(); i++)
+		this->cells[cell].push_back(entity);
+	}
+
+	void Remove(Entity* entity)
+	{
+		std::unordered_map<Entity*, long long>::iterator it = this->entityCells.find(entity);
+
+		if (it != this->entityCells.end())
 		{
-			if (!EntityManager::Get()->terrains[i]->HasComponent<Position2D>() || !EntityManager::Get()->terrains[i]->HasComponent<Hitbox2D>()) continue;
+			this->RemoveFromCell(entity, it->second);
+			this->entityCells.erase(it);
+		}
+	}
+
+	bool Contains(Entity* entity)
+	{
+		return this->entityCells.find(entity) != this->entityCells.end();
+	}
+
+	// ADAUGA IN result TOATE ENTITATILE DIN CELULELE CARE INTERSECTEAZA DREPTUNGHIUL (POATE INTOARCE SI ENTITATI PUTIN IN AFARA LUI)
+	template<typename Allocator>
+	void Query(double minX, double minY, double maxX, double maxY, std::vector<Entity*, Allocator>& result)
+	{
+		int minCellX = this->GetCellCoordinate(minX);
+		int minCellY = this->GetCellCoordinate(minY);
+		int maxCellX = this->GetCellCoordinate(maxX);
+		int maxCellY = this->GetCellCoordinate(maxY);
 
-			for (int j = 0; j < EntityManager::Get()->characters.size(); j++)
+		for (int cellX = minCellX; cellX <= maxCellX; cellX++)
+		{
+			for (int cellY = minCellY; cellY <= maxCellY; cellY++)
 			{
-				if (!EntityManager::Get()->characters[j]->HasComponent<Position2D>() || !EntityManager::Get()->characters[j]->HasComponent<Hitbox2D>()) continue;
+				std::unordered_map<long long, std::vector<Entity*>>::iterator it = this->cells.find(this->GetCellKey(cellX, cellY));
 
-				if (std::max(EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->x - EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->width / 2.0, EntityManager::Get()->characters[j]->GetComponent<Position2D>()->x - EntityManager::Get()->characters[j]->GetComponent<Hitbox2D>()->width / 2.0) <=
-					std::min(EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->x + EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->width / 2.0, EntityManager::Get()->characters[j]->GetComponent<Position2D>()->x + EntityManager::Get()->characters[j]->GetComponent<Hitbox2D>()->width / 2.0) &&
-					std::max(EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->y - EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->height / 2.0, EntityManager::Get()->characters[j]->GetComponent<Position2D>()->y - EntityManager::Get()->characters[j]->GetComponent<Hitbox2D>()->height / 2.0) <=
-					std::min(EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->y + EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->height / 2.0, EntityManager::Get()->characters[j]->GetComponent<Position2D>()->y + EntityManager::Get()->characters[j]->GetComponent<Hitbox2D>()->height / 2.0))
+				if (it != this->cells.end())
 				{
-					// COLIZIUNE CU REZOLVARE PE AXA OX
-					if (EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->width / 2.0 + EntityManager::Get()->characters[j]->GetComponent<Hitbox2D>()->width / 2.0 - std::abs(EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->x - EntityManager::Get()->characters[j]->GetComponent<Position2D>()->x) < EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->height / 2.0 + EntityManager::Get()->characters[j]->GetComponent<Hitbox2D>()->height / 2.0 - std::abs(EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->y - EntityManager::Get()->characters[j]->GetComponent<Position2D>()->y))
-					{
-						if (EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->x < EntityManager::Get()->characters[j]->GetComponent<Position2D>()->x)
-						{
-							EntityManager::Get()->characters[j]->GetComponent<Position2D>()->x += EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->width / 2.0 + EntityManager::Get()->characters[j]->GetComponent<Hitbox2D>()->width / 2.0 - (EntityManager::Get()->characters[j]->GetComponent<Position2D>()->x - EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->x);
+					result.insert(result.end(), it->second.begin(), it->second.end());
+				}
+			}
+		}
+	}
 
-							if (EntityManager::Get()->characters[j]->HasComponent<MovementSpeed2D>())
-							{
-								if (EntityManager::Get()->characters[j]->GetComponent<MovementSpeed2D>()->wentLeft)
-								{
-									EntityManager::Get()->characters[j]->GetComponent<MovementSpeed2D>()->wentLeft = false;
-								}
-							}
+	void Clear()
+	{
+		this->cells.clear();
+		this->entityCells.clear();
+	}
 
-							if (EntityManager::Get()->characters[j]->HasComponent<Speed2D>())
-							{
-								if (EntityManager::Get()->characters[j]->GetComponent<Speed2D>()->speedX < 0.0)
-								{
-									EntityManager::Get()->characters[j]->GetComponent<Speed2D>()->speedX = 0.0;
-								}
-							}
-						}
-						else
-						{
-							EntityManager::Get()->characters[j]->GetComponent<Position2D>()->x -= EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->width / 2.0 + EntityManager::Get()->characters[j]->GetComponent<Hitbox2D>()->width / 2.0 - (EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->x - EntityManager::Get()->characters[j]->GetComponent<Position2D>()->x);
+	int GetEntityCount()
+	{
+		return (int)this->entityCells.size();
+	}
 
-							if (EntityManager::Get()->characters[j]->HasComponent<MovementSpeed2D>())
-							{
-								if (EntityManager::Get()->characters[j]->GetComponent<MovementSpeed2D>()->wentRight)
-								{
-									EntityManager::Get()->characters[j]->GetComponent<MovementSpeed2D>()->wentRight = false;
-								}
-							}
+private:
 
-							if (EntityManager::Get()->characters[j]->HasComponent<Speed2D>())
-							{
-								if (EntityManager::Get()->characters[j]->GetComponent<Speed2D>()->speedX > 0.0)
-								{
-									EntityManager::Get()->characters[j]->GetComponent<Speed2D>()->speedX = 0.0;
-								}
-							}
-						}
-					}
-					// PE AXA OY
-					else
-					{
-						if (EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->y < EntityManager::Get()->characters[j]->GetComponent<Position2D>()->y)
-						{
-							EntityManager::Get()->characters[j]->GetComponent<Position2D>()->y += EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->height / 2.0 + EntityManager::Get()->characters[j]->GetComponent<Hitbox2D>()->height / 2.0 - (EntityManager::Get()->characters[j]->GetComponent<Position2D>()->y - EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->y);
+	double cellSize;
 
-							EntityManager::Get()->characters[j]->GetComponent<Hitbox2D>()->collidedDownward = true;
+	std::unordered_map<long long, std::vector<Entity*>> cells;
+	std::unordered_map<Entity*, long long> entityCells;
 
-							if (EntityManager::Get()->characters[j]->HasComponent<Speed2D>())
-							{
-								if (EntityManager::Get()->characters[j]->GetComponent<Speed2D>()->speedY < 0.0)
-								{
-									EntityManager::Get()->characters[j]->GetComponent<Speed2D>()->speedY = 0.0;
-								}
-							}
-						}
-						else
-						{
-							EntityManager::Get()->characters[j]->GetComponent<Position2D>()->y -= EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->height / 2.0 + EntityManager::Get()->characters[j]->GetComponent<Hitbox2D>()->height / 2.0 - (EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->y - EntityManager::Get()->characters[j]->GetComponent<Position2D>()->y);
+	int GetCellCoordinate(double value)
+	{
+		return (int)std::floor(value / this->cellSize);
+	}
 
-							if (EntityManager::Get()->characters[j]->HasComponent<Speed2D>())
-							{
-								if (EntityManager::Get()->characters[j]->GetComponent<Speed2D>()->speedY > 0.0)
-								{
-									EntityManager::Get()->characters[j]->GetComponent<Speed2D>()->speedY = 0.0;
-								}
-							}
-						}
-					}
+	long long GetCellKey(int cellX, int cellY)
+	{
+		return (long long)(((unsigned long long)(unsigned int)cellX << 32) | (unsigned int)cellY);
+	}
 
-				}
-			}
+	void RemoveFromCell(Entity* entity, long long cell)
+	{
+		std::vector<Entity*>& entities = this->cells[cell];
 
-			for (int j = 0; j < EntityManager::Get()->bullets.size(); j++)
+		for (int i = 0; i < entities.size(); i++)
+		{
+			if (entities[i] == entity)
 			{
-				if (!EntityManager::Get()->bullets[j]->HasComponent<Position2D>() || !EntityManager::Get()->bullets[j]->HasComponent<Hitbox2D>()) continue;
+				entities[i] = entities[entities.size() - 1];
+				entities.pop_back();
 
-				if (std::max(EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->x - EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->width / 2.0, EntityManager::Get()->bullets[j]->GetComponent<Position2D>()->x - EntityManager::Get()->bullets[j]->GetComponent<Hitbox2D>()->width / 2.0) <=
-					std::min(EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->x + EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->width / 2.0, EntityManager::Get()->bullets[j]->GetComponent<Position2D>()->x + EntityManager::Get()->bullets[j]->GetComponent<Hitbox2D>()->width / 2.0) &&
-					std::max(EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->y - EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->height / 2.0, EntityManager::Get()->bullets[j]->GetComponent<Position2D>()->y - EntityManager::Get()->bullets[j]->GetComponent<Hitbox2D>()->height / 2.0) <=
-					std::min(EntityManager::Get()->terrains[i]->GetComponent<Position2D>()->y + EntityManager::Get()->terrains[i]->GetComponent<Hitbox2D>()->height / 2.0, EntityManager::Get()->bullets[j]->GetComponent<Position2D>()->y + EntityManager::Get()->bullets[j]->GetComponent<Hitbox2D>()->height / 2.0))
-				{
-					EntityManager::Get()->RemoveBullet(j);
-					j--;
-				}
+				break;
 			}
 		}
-	}
 
-private:
+		// CELULA GOALA RAMANE IN HARTA, CU VECTORUL EI: O ENTITATE CARE SE INTOARCE NU MAI ALOCA NODUL SI VECTORUL DIN NOU (Clear LE ELIBEREAZA)
+	}
+};
 
-	static CollisionManager* instance;
+// CLASA ENTITY POOL
 
-	CollisionManager() {};
+// CUM E FOLOSITA MEMORIA POOL-ULUI DE ENTITATI
+struct EntityPoolStatistics
+{
+	int liveEntities = 0;
 
-	CollisionManager(const CollisionManager&) = delete;
+	std::size_t reservedBytes = 0;
+	std::size_t usedBytes = 0; // BLOCURILE OCUPATE (CU TOT CU ROTUNJIREA LA CLASA DE MARIME)
+	std::size_t freeBytes = 0; // BLOCURILE LIBERE, GATA DE REFOLOSIT
 
+	double fragmentation = 0.0; // freeBytes / reservedBytes: CAT DIN CE E REZERVAT NU E FOLOSIT
 };
 
-CollisionManager* CollisionManager::instance = nullptr;
-
-// CLASA ANIMATION MANAGER
-
-class AnimationManager
+// MEMORIA ENTITATILOR UNEI LUMI (new Entity / delete AJUNG AICI, VEZI Entity::operator new). BLOCURI DE MARIMI FIXE, GRUPATE PE CLASE
+// DE CATE 64 DE OCTETI (ENTITATILE DERIVATE, MAI MARI, AU CLASA LOR), CU O LISTA DE BLOCURI LIBERE PE CLASA. BLOCURILE VIN DIN ARENA LUMII
+// DACA ARE UNA. MEMORIA NU SE INTOARCE LA SISTEM DECAT ODATA CU LUMEA, DECI UN NIVEL NOU REFOLOSESTE BLOCURILE CELUI DESCARCAT
+// FIECARE BLOC INCEPE CU UN ANTET CARE TINE MINTE POOL-UL DIN CARE A FOST LUAT, CA SA FIE INTORS ACOLO CHIAR DACA E STERS IN ALTA LUME
+class EntityPool
 {
 public:
 
-	static AnimationManager* Get()
+	static EntityPool* Get()
 	{
-		if (AnimationManager::instance == nullptr)
+		World* world = World::GetCurrent();
+
+		if (world->entityPool == nullptr)
 		{
-			AnimationManager::instance = new AnimationManager();
+			world->entityPool = new EntityPool();
 		}
 
-		return AnimationManager::instance;
+		return world->entityPool;
 	}
 
-	void UpdateAnimations()
+	void* Allocate(std::size_t size)
 	{
-		for (int i = 0; i < EntityManager::Get()->animatedEntities.size(); i++)
-		{
-			if (EntityManager::Get()->animatedEntities[i]->HasComponent<Speed2D>() && EntityManager::Get()->animatedEntities[i]->HasComponent<Texture2D>() && EntityManager::Get()->animatedEntities[i]->HasComponent<Animation2D>())
-			{
-				EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->lastEntityAnimation = EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->currentEntityAnimation;
+		size += EntityPool::HEADER_SIZE;
 
-				if (EntityManager::Get()->animatedEntities[i]->GetComponent<Speed2D>()->speedY == 0.0)
-				{
-					if (EntityManager::Get()->animatedEntities[i]->GetComponent<Speed2D>()->speedX == 0.0)
-					{
-						EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->currentEntityAnimation = EntityAnimation::standing;
-					}
-					else if (EntityManager::Get()->animatedEntities[i]->GetComponent<Speed2D>()->speedX > 0.0)
-					{
-						EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->currentEntityAnimation = EntityAnimation::walkingRight;
-					}
-					else
-					{
-						EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->currentEntityAnimation = EntityAnimation::walkingLeft;
-					}
-				}
-				else if (EntityManager::Get()->animatedEntities[i]->GetComponent<Speed2D>()->speedY > 0.0)
-				{
-					if (EntityManager::Get()->animatedEntities[i]->GetComponent<Speed2D>()->speedX >= 0.0)
-					{
-						EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->currentEntityAnimation = EntityAnimation::jumpingRight;
-					}
-					else
-					{
-						EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->currentEntityAnimation = EntityAnimation::jumpingLeft;
-					}
-				}
-				else
-				{
-					if (EntityManager::Get()->animatedEntities[i]->GetComponent<Speed2D>()->speedX >= 0.0)
-					{
-						EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->currentEntityAnimation = EntityAnimation::fallingRight;
-					}
-					else
-					{
-						EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->currentEntityAnimation = EntityAnimation::fallingLeft;
-					}
-				}
-			}
+		int sizeClass = this->GetSizeClass(size);
 
-			if (EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->currentEntityAnimation == EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->lastEntityAnimation)
-			{
-				if (TimeManager::Get()->GetCurrentTime() - EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->timeWhenCurrentTextureSelected >= EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->frameTime)
-				{
-					EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->animationIndex++;
+		if (sizeClass >= EntityPool::SIZE_CLASSES)
+		{
+			this->liveEntities++;
 
-					if (EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->animationIndex >= EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->animations[(int)EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->currentEntityAnimation].size())
-					{
-						EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->animationIndex = 0;
-					}
+			return this->WriteHeader(::operator new(size));
+		}
 
-					EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->timeWhenCurrentTextureSelected = TimeManager::Get()->GetCurrentTime();
-					EntityManager::Get()->animatedEntities[i]->GetComponent<Texture2D>()->currentTextureID = EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->animations[(int)EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->currentEntityAnimation][EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->animationIndex];
-				}
+		if (this->freeBlocks[sizeClass].empty())
+		{
+			// UN CHUNK NOU, TAIAT IN BLOCURI DE ACEEASI MARIME
+			std::size_t blockSize = (std::size_t)(sizeClass + 1) * EntityPool::GRANULARITY;
+			char* chunk = nullptr;
+
+			if (this->arena != nullptr)
+			{
+				chunk = (char*)this->arena->Allocate(blockSize * EntityPool::BLOCKS_PER_CHUNK);
 			}
 			else
 			{
-				EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->animationIndex = 0;
-				EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->timeWhenCurrentTextureSelected = TimeManager::Get()->GetCurrentTime();
-				EntityManager::Get()->animatedEntities[i]->GetComponent<Texture2D>()->currentTextureID = EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->animations[(int)EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->currentEntityAnimation][EntityManager::Get()->animatedEntities[i]->GetComponent<Animation2D>()->animationIndex];
-
+				chunk = (char*)::operator new(blockSize * EntityPool::BLOCKS_PER_CHUNK);
+				this->chunks.push_back(chunk);
 			}
-		}
-	}
 
-private:
+			for (int i = EntityPool::BLOCKS_PER_CHUNK - 1; i >= 0; i--)
+			{
+				this->freeBlocks[sizeClass].push_back(chunk + i * blockSize);
+			}
 
-	static AnimationManager* instance;
+			this->reservedBytes += blockSize * EntityPool::BLOCKS_PER_CHUNK;
+		}
 
-	AnimationManager() {};
+		void* block = this->freeBlocks[sizeClass].back();
+		this->freeBlocks[sizeClass].pop_back();
 
-	AnimationManager(const AnimationManager&) = delete;
-};
+		this->liveEntities++;
+		this->usedBytes += (std::size_t)(sizeClass + 1) * EntityPool::GRANULARITY;
 
-AnimationManager* AnimationManager::instance = nullptr;
+		return this->WriteHeader(block);
+	}
 
-// CLASA ARTIFICIAL INTELLIGENCE MANAGER
+	// INTOARCE BLOCUL POOL-ULUI DIN CARE A FOST ALOCAT (SCRIS IN ANTET), NU NEAPARAT AL LUMII CURENTE
+	static void Free(void* entity, std::size_t size)
+	{
+		void* block = (char*)entity - EntityPool::HEADER_SIZE;
 
-class ArtificialIntelligenceManager
-{
-public:
+		(*(EntityPool**)block)->FreeBlock(block, size + EntityPool::HEADER_SIZE);
+	}
 
-	static ArtificialIntelligenceManager* Get()
+	// ELIBERAT DOAR ODATA CU LUMEA, DUPA ENTITATI
+	~EntityPool()
 	{
-		if (ArtificialIntelligenceManager::instance == nullptr)
+		for (int i = 0; i < this->chunks.size(); i++)
 		{
-			ArtificialIntelligenceManager::instance = new ArtificialIntelligenceManager();
+			::operator delete(this->chunks[i]);
 		}
-
-		return ArtificialIntelligenceManager::instance;
 	}
 
-	void UpdateArtificialIntelligence()
+	EntityPoolStatistics GetStatistics()
 	{
-		if (Player::Get()->GetEntity() != nullptr) // DACA EXISTA JUCATORUL
+		EntityPoolStatistics statistics;
+		statistics.liveEntities = this->liveEntities;
+		statistics.reservedBytes = this->reservedBytes;
+		statistics.usedBytes = this->usedBytes;
+		statistics.freeBytes = this->reservedBytes - this->usedBytes;
+
+		if (this->reservedBytes > 0)
 		{
-			if (Player::Get()->GetEntity()->HasComponent<Position2D>())
-			{
-				for (int i = 0; i < EntityManager::Get()->artificalIntelligence.size(); i++)
-				{
-					if (EntityManager::Get()->artificalIntelligence[i]->HasComponent<Position2D>() && EntityManager::Get()->artificalIntelligence[i]->HasComponent<Speed2D>() && EntityManager::Get()->artificalIntelligence[i]->HasComponent<MovementSpeed2D>() && EntityManager::Get()->artificalIntelligence[i]->HasComponent<ArtificialIntelligence2D>())
-					{
-						///////////////////////////////////////////////////////////////////////////////////////////////////////////////
+			statistics.fragmentation = (double)statistics.freeBytes / this->reservedBytes;
+		}
 
-						if (EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->wentRight)
-						{
-							EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->wentRight = false;
+		return statistics;
+	}
 
-							EntityManager::Get()->artificalIntelligence[i]->GetComponent<Speed2D>()->speedX -= EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->speedX;
-						}
+private:
 
-						if (EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->wentLeft)
-						{
-							EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->wentLeft = false;
+	static const int GRANULARITY = 64;
+	static const int SIZE_CLASSES = 16;
+	static const int BLOCKS_PER_CHUNK = 64;
+	static const int HEADER_SIZE = alignof(std::max_align_t); // ENTITATEA DE DUPA ANTET RAMANE ALINIATA CA LA ::operator new
 
-							EntityManager::Get()->artificalIntelligence[i]->GetComponent<Speed2D>()->speedX += EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->speedX;
-						}
+	std::vector<void*> freeBlocks[EntityPool::SIZE_CLASSES];
+	std::vector<char*> chunks;
 
-						// DACA ENTITATEA ESTE AGRESIVA FATA DE JUCATOR
-						if (EntityManager::Get()->artificalIntelligence[i]->GetComponent<ArtificialIntelligence2D>()->state == ArtificialIntelligence::aggresive)
-						{
-							if (Player::Get()->GetEntity()->GetComponent<Position2D>()->x < EntityManager::Get()->artificalIntelligence[i]->GetComponent<Position2D>()->x - AI::EPSILON_X_AGGRESIVE)
-							{
+	MemoryArena* arena; // ARENA LUMII IN CARE A FOST CREAT POOL-UL (SAU nullptr)
 
-								EntityManager::Get()->artificalIntelligence[i]->GetComponent<Speed2D>()->speedX -= EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->speedX;
+	int liveEntities = 0;
+	std::size_t reservedBytes = 0;
+	std::size_t usedBytes = 0;
 
-								EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->wentLeft = true;
+	int GetSizeClass(std::size_t size)
+	{
+		return (int)((size + EntityPool::GRANULARITY - 1) / EntityPool::GRANULARITY) - 1;
+	}
 
-								///*
-								if (EntityManager::Get()->artificalIntelligence[i]->GetComponent<Hitbox2D>()->collidedDownward)
-								{
-									EntityManager::Get()->artificalIntelligence[i]->GetComponent<Hitbox2D>()->collidedDownward = false;
+	void* WriteHeader(void* block)
+	{
+		*(EntityPool**)block = this;
 
-									EntityManager::Get()->artificalIntelligence[i]->GetComponent<Speed2D>()->speedY += EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->speedY;
-								}
-								//*/
-							}
+		return (char*)block + EntityPool::HEADER_SIZE;
+	}
 
-							if (Player::Get()->GetEntity()->GetComponent<Position2D>()->x > EntityManager::Get()->artificalIntelligence[i]->GetComponent<Position2D>()->x + AI::EPSILON_X_AGGRESIVE)
-							{
+	void FreeBlock(void* block, std::size_t size)
+	{
+		int sizeClass = this->GetSizeClass(size);
 
-								EntityManager::Get()->artificalIntelligence[i]->GetComponent<Speed2D>()->speedX += EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->speedX;
+		this->liveEntities--;
 
-								EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->wentRight = true;
+		if (sizeClass >= EntityPool::SIZE_CLASSES)
+		{
+			::operator delete(block);
 
-								///*
-								if (EntityManager::Get()->artificalIntelligence[i]->GetComponent<Hitbox2D>()->collidedDownward)
-								{
-									EntityManager::Get()->artificalIntelligence[i]->GetComponent<Hitbox2D>()->collidedDownward = false;
+			return;
+		}
 
-									EntityManager::Get()->artificalIntelligence[i]->GetComponent<Speed2D>()->speedY += EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->speedY;
-								}
-								//*/
-							}
+		this->freeBlocks[sizeClass].push_back(block);
 
-							if (EntityManager::Get()->artificalIntelligence[i]->GetComponent<Hitbox2D>()->collidedDownward && Player::Get()->GetEntity()->GetComponent<Position2D>()->y > EntityManager::Get()->artificalIntelligence[i]->GetComponent<Position2D>()->y + AI::EPSILON_Y_AGGRESIVE)
-							{
-								EntityManager::Get()->artificalIntelligence[i]->GetComponent<Hitbox2D>()->collidedDownward = false;
+		this->usedBytes -= (std::size_t)(sizeClass + 1) * EntityPool::GRANULARITY;
+	}
 
-								EntityManager::Get()->artificalIntelligence[i]->GetComponent<Speed2D>()->speedY += EntityManager::Get()->artificalIntelligence[i]->GetComponent<MovementSpeed2D>()->speedY;
+	EntityPool()
+	{
+		this->arena = World::GetCurrent()->GetArena();
+	}
+
+	EntityPool(const EntityPool&) = delete;
+};
+
+// CLASA ENTITY MANAGER
+
+class EntityManager
+{
+public:
+
+	static EntityManager* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->entityManager == nullptr)
+		{
+			world->entityManager = new EntityManager();
+		}
+
+		return world->entityManager;
+	}
+
+	void AddCharacter(Entity* entity)
+	{
+		this->characters.push_back(entity);
+	}
+
+	void AddTerrain(Entity* entity)
+	{
+		this->terrains.push_back(entity);
+	}
+
+	void AddBullet(Entity* entity)
+	{
+		this->bullets.push_back(entity);
+	}
+
+	void AddLandScape(Entity* entity)
+	{
+		this->landScapes.push_back(entity);
+	}
+
+	void AddAnimatedEntity(Entity* entity)
+	{
+		this->animatedEntities.push_back(entity);
+	}
+
+	void AddArtificialIntelligence(Entity* entity)
+	{
+		this->artificalIntelligence.push_back(entity);
+
+		// POZITIA NU E CUNOSCUTA INCA (COMPONENTELE SE ADAUGA DUPA CONSTRUCTOR). ArtificialIntelligenceManager O PUNE IN GRID LA URMATORUL UPDATE
+		this->artificialIntelligenceToPlace.push_back(entity);
+	}
+
+	void RemoveCharacter(Entity* entity) // DOAR ELIMINA DIN MANAGER. ARE OVERHEAD DE MEMORIE DACA NU STERGEM ENTITATEA MANUAL
+	{
+		for (int i = 0; i < this->characters.size(); i++)
+		{
+			if (this->characters[i] == entity)
+			{
+				this->characters[i] = this->characters[this->characters.size() - 1];
+				this->characters.pop_back();
+
+				return;
+			}
+		}
+	}
+
+	void RemoveTerrain(Entity* entity) // DOAR ELIMINA DIN MANAGER. ARE OVERHEAD DE MEMORIE DACA NU STERGEM ENTITATEA MANUAL
+	{
+		for (int i = 0; i < this->terrains.size(); i++)
+		{
+			if (this->terrains[i] == entity)
+			{
+				this->terrains[i] = this->terrains[this->terrains.size() - 1];
+				this->terrains.pop_back();
+
+				return;
+			}
+		}
+	}
+
+	void RemoveBullet(Entity* entity)
+	{
+		for (int i = 0; i < this->bullets.size(); i++)
+		{
+			if (this->bullets[i] == entity)
+			{
+				this->bullets[i] = this->bullets[this->bullets.size() - 1];
+				this->bullets.pop_back();
+
+				return;
+			}
+		}
+	}
+
+	void RemoveLandScape(Entity* entity)
+	{
+		for (int i = 0; i < this->landScapes.size(); i++)
+		{
+			if (this->landScapes[i] == entity)
+			{
+				this->landScapes[i] = this->landScapes[this->landScapes.size() - 1];
+				this->landScapes.pop_back();
+
+				return;
+			}
+		}
+	}
+
+	void RemoveAnimatedEntity(Entity* entity)
+	{
+		for (int i = 0; i < this->animatedEntities.size(); i++)
+		{
+			if (this->animatedEntities[i] == entity)
+			{
+				this->animatedEntities[i] = this->animatedEntities[this->animatedEntities.size() - 1];
+				this->animatedEntities.pop_back();
+
+				break;
+			}
+		}
+
+		for (int i = 0; i < this->animationStateChanges.size(); i++)
+		{
+			if (this->animationStateChanges[i] == entity)
+			{
+				this->animationStateChanges[i] = this->animationStateChanges[this->animationStateChanges.size() - 1];
+				this->animationStateChanges.pop_back();
+
+				return;
+			}
+		}
+	}
+
+	void RemoveArtificialIntelligence(Entity* entity)
+	{
+		for (int i = 0; i < this->artificalIntelligence.size(); i++)
+		{
+			if (this->artificalIntelligence[i] == entity)
+			{
+				this->artificalIntelligence[i] = this->artificalIntelligence[this->artificalIntelligence.size() - 1];
+				this->artificalIntelligence.pop_back();
+
+				break;
+			}
+		}
+
+		for (int i = 0; i < this->artificialIntelligenceToPlace.size(); i++)
+		{
+			if (this->artificialIntelligenceToPlace[i] == entity)
+			{
+				this->artificialIntelligenceToPlace[i] = this->artificialIntelligenceToPlace[this->artificialIntelligenceToPlace.size() - 1];
+				this->artificialIntelligenceToPlace.pop_back();
+
+				break;
+			}
+		}
+
+		for (int i = 0; i < this->activeArtificialIntelligence.size(); i++)
+		{
+			if (this->activeArtificialIntelligence[i] == entity)
+			{
+				this->activeArtificialIntelligence[i] = this->activeArtificialIntelligence[this->activeArtificialIntelligence.size() - 1];
+				this->activeArtificialIntelligence.pop_back();
+
+				break;
+			}
+		}
+
+		for (int i = 0; i < this->pendingArtificialIntelligence.size(); i++)
+		{
+			if (this->pendingArtificialIntelligence[i] == entity)
+			{
+				this->pendingArtificialIntelligence.erase(this->pendingArtificialIntelligence.begin() + i);
+
+				break;
+			}
+		}
+
+		this->behaviorGrid.Remove(entity);
+		this->RemoveFromList(this->groundedBehaviors, entity);
+		this->RemoveFromList(this->behaviorsToResume, entity);
+
+		this->artificialIntelligenceGrid.Remove(entity);
+	}
+
+	void RemoveCharacter(int index)
+	{
+		if (0 <= index && index <= this->characters.size())
+		{
+			this->characters[index] = this->characters[this->characters.size() - 1];
+			this->characters.pop_back();
+		}
+	}
+
+	void RemoveTerrain(int index)
+	{
+		if (0 <= index && index <= this->terrains.size())
+		{
+			this->terrains[index] = this->terrains[this->terrains.size() - 1];
+			this->terrains.pop_back();
+		}
+	}
+
+	void RemoveBullet(int index)
+	{
+		if (0 <= index && index <= this->bullets.size())
+		{
+			this->bullets[index] = this->bullets[this->bullets.size() - 1];
+			this->bullets.pop_back();
+		}
+	}
+
+	// CA SI VARIANTA CU POINTER, SCOATE ENTITATEA SI DIN animationStateChanges
+	void RemoveAnimatedEntity(int index)
+	{
+		if (0 <= index && index < this->animatedEntities.size())
+		{
+			this->RemoveAnimatedEntity(this->animatedEntities[index]);
+		}
+	}
+
+	// CA SI VARIANTA CU POINTER, SCOATE ENTITATEA SI DIN GRIDURI SI DIN LISTELE PLANIFICATORULUI
+	void RemoveArtificialIntelligence(int index)
+	{
+		if (0 <= index && index < this->artificalIntelligence.size())
+		{
+			this->RemoveArtificialIntelligence(this->artificalIntelligence[index]);
+		}
+	}
+
+	// ENTITATILE CREATE DE AICI INCOLO (PANA LA EndLevel) APARTIN UNUI NIVEL NOU, CU ID-UL INTORS, SI POT FI STERSE IMPREUNA CU UnloadLevel
+	int BeginLevel()
+	{
+		this->lastLevel++;
+		this->currentLevel = this->lastLevel;
+
+		return this->currentLevel;
+	}
+
+	// ENTITATILE NOI NU MAI APARTIN NICIUNUI NIVEL (NIVELUL 0, CARE NU E DESCARCAT NICIODATA)
+	void EndLevel()
+	{
+		this->currentLevel = 0;
+	}
+
+	int GetCurrentLevel()
+	{
+		return this->currentLevel;
+	}
+
+	int GetLevelEntityCount(int level)
+	{
+		std::unordered_map<int, std::vector<Entity*>>::iterator it = this->levelEntities.find(level);
+
+		return it == this->levelEntities.end() ? 0 : (int)it->second.size();
+	}
+
+	// STERGE TOATE ENTITATILE NIVELULUI. DACA NIVELUL CUPRINDE TOATE ENTITATILE LUMII, ELE SUNT STERSE IN BLOC (VEZI DeleteAllEntities).
+	// ALTFEL LISTELE SUNT FILTRATE O SINGURA DATA, IAR ENTITATILE SUNT STERSE UNA CATE UNA, FARA SA MAI FIE CAUTATE IN LISTE. DEFINIT DUPA Entity
+	void UnloadLevel(int level);
+
+	// STERGE TOATE ENTITATILE. DESTRUCTORII SE APELEAZA, DAR ENTITATILE NU SE MAI SCOT UNA CATE UNA DIN LISTE SI DIN STOCARI (CAUTARI LINIARE,
+	// MUTARI DE COMPONENTE): LISTELE SI STOCARILE SUNT GOLITE LA SFARSIT, IAR BLOCURILE ENTITATILOR SE INTORC IN EntityPool. DEFINIT DUPA Entity
+	void DeleteAllEntities();
+
+	// ADEVARAT IN TIMPUL LUI DeleteAllEntities (DESTRUCTORUL ENTITATII NU MAI FACE CURATENIE)
+	bool IsDeletingAllEntities()
+	{
+		return this->isDeletingAllEntities;
+	}
+
+	// NIVELUL DESCARCAT DE UnloadLevel IN ACEST MOMENT, SAU 0 (ENTITATILE LUI AU FOST DEJA SCOASE DIN LISTE)
+	int GetUnloadingLevel()
+	{
+		return this->unloadingLevel;
+	}
+
+	// APELATE DE CONSTRUCTORUL SI DESTRUCTORUL ENTITATII. DEFINITE DUPA Entity
+	void AddToLevel(Entity* entity);
+	void RemoveFromLevel(Entity* entity);
+
+	void RemoveAllEntities() // DOAR ELIMINA DIN MANAGER. ARE OVERHEAD DE MEMORIE DACA NU STERGEM ENTITATEA MANUAL (VEZI DeleteAllEntities)
+	{
+		this->characters.clear();
+		this->terrains.clear();
+		this->bullets.clear();
+		this->landScapes.clear();
+
+		this->animatedEntities.clear();
+		this->animationStateChanges.clear();
+
+		this->artificalIntelligence.clear();
+		this->artificialIntelligenceGrid.Clear();
+		this->artificialIntelligenceToPlace.clear();
+		this->activeArtificialIntelligence.clear();
+		this->pendingArtificialIntelligence.clear();
+
+		this->behaviorGrid.Clear();
+		this->groundedBehaviors.clear();
+		this->behaviorsToResume.clear();
+	}
+
+	std::vector<Entity*> characters;
+	std::vector<Entity*> terrains;
+	std::vector<Entity*> bullets;
+	std::vector<Entity*> landScapes; // FUNDALURI, NU PARTICIPA LA MISCARE SI COLIZIUNI
+
+	std::vector<Entity*> animatedEntities;
+
+	std::vector<Entity*> artificalIntelligence;
+
+	std::vector<Entity*> animationStateChanges; // ENTITATI ANIMATE CARORA LI S-A SCHIMBAT SEMNUL VITEZEI IN ACEST CADRU
+
+	SpatialGrid artificialIntelligenceGrid; // ENTITATILE CU AI DUPA POZITIE, PENTRU NIVELELE DE DETALIU DIN ArtificialIntelligenceManager
+	std::vector<Entity*> artificialIntelligenceToPlace;
+	std::vector<Entity*> activeArtificialIntelligence; // ENTITATILE CU AI CARE NU DORM
+	std::vector<Entity*> pendingArtificialIntelligence; // ENTITATILE CU AI CARE ASTEAPTA SA FIE ACTUALIZATE (PLANIFICATORUL CU BUGET)
+
+	SpatialGrid behaviorGrid; // COMPORTAMENTELE SUSPENDATE IN UntilPlayerWithin, DUPA POZITIE
+	std::vector<Entity*> groundedBehaviors; // COMPORTAMENTELE SUSPENDATE IN UntilGrounded CARE AU ATINS SOLUL IN ACEST CADRU
+	std::vector<Entity*> behaviorsToResume;
+
+private:
+
+	int currentLevel = 0;
+	int lastLevel = 0;
+
+	std::unordered_map<int, std::vector<Entity*>> levelEntities; // DOAR NIVELELE DIFERITE DE 0
+
+	bool isDeletingAllEntities = false;
+	int unloadingLevel = 0;
+
+	template<typename Predicate>
+	void RemoveFromListIf(std::vector<Entity*>& entities, Predicate predicate)
+	{
+		entities.erase(std::remove_if(entities.begin(), entities.end(), predicate), entities.end());
+	}
+
+	void RemoveFromList(std::vector<Entity*>& entities, Entity* entity)
+	{
+		for (int i = 0; i < entities.size(); i++)
+		{
+			if (entities[i] == entity)
+			{
+				entities[i] = entities[entities.size() - 1];
+				entities.pop_back();
+
+				i--;
+			}
+		}
+	}
+
+	EntityManager() {};
+
+	EntityManager(const EntityManager&) = delete;
+};
+
+// STRUCTURA TEXTURA
+
+struct Texture
+{
+	unsigned int ID = 0;
+
+	int width = 0;
+	int height = 0;
+
+	int nrChannels = 0;
+};
+
+// CLASA RENDER BACKEND
+
+enum class BufferUsage
+{
+	STATIC,
+	DYNAMIC,
+	STREAM,
+};
+
+// TOATE APELURILE CATRE PLACA VIDEO ALE RANDARII (SHADERE, BUFFERE, TEXTURI, DESENARE) TREC PRIN BACKEND-UL CURENT.
+// IMPLICIT E CEL OPENGL, IAR PE MASINILE FARA PLACA VIDEO SE POATE FOLOSI RecordingRenderBackend. E COMUN TUTUROR LUMILOR, CA FEREASTRA,
+// SI SE FOLOSESTE DOAR DE PE FIRUL PRINCIPAL
+// VARFURILE SUNT MEREU (x, y, u, v) IN float, IAR BUFFERELE DE VARFURI SUNT GL_ARRAY_BUFFER
+class RenderBackend
+{
+public:
+
+	// BACKEND-UL PRIN CARE SE FAC APELURILE: GetTarget() CU RenderStateCache IN FATA (DACA CACHE-UL E ACTIVAT). DEFINIT DUPA RenderStateCache
+	static RenderBackend* Get();
+
+	// BACKEND-UL ALES (OpenGL DACA NU S-A ALES ALTUL), FARA CACHE
+	static RenderBackend* GetTarget();
+
+	// nullptr REVINE LA OpenGL. BACKEND-UL NU E STERS DE ENGINE
+	static void Set(RenderBackend* backend)
+	{
+		assert(IsMainThread());
+
+		RenderBackend::current = backend;
+	}
+
+	virtual ~RenderBackend() {};
+
+	// FALSE DACA APELURILE NU POT FI FACUTE (OpenGL FARA FEREASTRA). ATUNCI RenderQueue DOAR EMITE COMENZILE
+	virtual bool IsAvailable() = 0;
+
+	virtual unsigned int CreateProgram(const std::string& vertexShaderCode, const std::string& fragmentShaderCode) = 0;
+	virtual void DeleteProgram(unsigned int programID) = 0;
+	virtual void UseProgram(unsigned int programID) = 0;
+
+	// UNIFORM-URILE SE SETEAZA PENTRU PROGRAMUL IN FOLOSINTA
+	virtual int GetUniformLocation(unsigned int programID, const std::string& name) = 0;
+	virtual void SetUniform(int location, const glm::mat4& value) = 0;
+	virtual void SetUniform(int location, int value) = 0;
+
+	// UN VERTEX ARRAY CU BUFFER-UL LUI, IN FORMATUL (x, y, u, v). AMANDOUA RAMAN LEGATE DUPA CREARE
+	virtual void CreateVertexArray(unsigned int& VAOID, unsigned int& VBOID) = 0;
+	virtual void DeleteVertexArray(unsigned int VAOID, unsigned int VBOID) = 0;
+	virtual void BindVertexArray(unsigned int VAOID) = 0;
+
+	// BufferData SI BufferSubData SCRIU IN BUFFER-UL LEGAT CU BindBuffer
+	virtual void BindBuffer(unsigned int VBOID) = 0;
+	virtual void BufferData(const void* data, std::size_t bytes, BufferUsage usage) = 0;
+	virtual void BufferSubData(std::size_t offset, const void* data, std::size_t bytes) = 0;
+
+	// TEXTURA E CREATA CU REPETARE SI FILTRARE NEAREST. UploadTexture PRIMESTE PIXELI RGBA
+	// AMANDOUA LASA TEXTURA LEGATA LA UNITATEA ACTIVA
+	virtual unsigned int CreateTexture() = 0;
+	virtual void UploadTexture(unsigned int textureID, int width, int height, const unsigned char* data) = 0;
+	virtual void ActiveTexture(int unit) = 0;
+	virtual void BindTexture(unsigned int textureID) = 0;
+
+	// AMESTECARE CU TRANSPARENTA (SRC_ALPHA, ONE_MINUS_SRC_ALPHA)
+	virtual void SetBlending(bool enabled) = 0;
+
+	// ZONA FERESTREI IN CARE SE DESENEAZA, IN PIXELI, CU ORIGINEA IN COLTUL DE JOS DIN STANGA
+	virtual void SetViewport(int x, int y, int width, int height) = 0;
+
+	virtual void DrawTriangles(int firstVertex, int vertexCount) = 0;
+
+private:
+
+	static RenderBackend* current;
+};
+
+RenderBackend* RenderBackend::current = nullptr;
+
+class GLRenderBackend : public RenderBackend
+{
+public:
+
+	bool IsAvailable() override
+	{
+		return WindowManager::Get()->GetWindow() != nullptr;
+	}
+
+	unsigned int CreateProgram(const std::string& vertexShaderCode, const std::string& fragmentShaderCode) override
+	{
+		const char* vertexCstr = vertexShaderCode.c_str();
+		const char* fragmentCstr = fragmentShaderCode.c_str();
+
+		unsigned int vertexShaderID = glCreateShader(GL_VERTEX_SHADER);
+		unsigned int fragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
+
+		glShaderSource(vertexShaderID, 1, &vertexCstr, 0);
+		glShaderSource(fragmentShaderID, 1, &fragmentCstr, 0);
+
+		glCompileShader(vertexShaderID);
+		glCompileShader(fragmentShaderID);
+
+		unsigned int programID = glCreateProgram();
+		glAttachShader(programID, vertexShaderID);
+		glAttachShader(programID, fragmentShaderID);
+
+		glLinkProgram(programID);
+
+		//glValidateProgram(programID);
+
+		// SHADERELE RAMAN ATASATE PROGRAMULUI SI SUNT STERSE ODATA CU EL
+		glDeleteShader(vertexShaderID);
+		glDeleteShader(fragmentShaderID);
+
+		return programID;
+	}
+
+	void DeleteProgram(unsigned int programID) override
+	{
+		glDeleteProgram(programID);
+	}
+
+	void UseProgram(unsigned int programID) override
+	{
+		glUseProgram(programID);
+	}
+
+	int GetUniformLocation(unsigned int programID, const std::string& name) override
+	{
+		return glGetUniformLocation(programID, name.c_str());
+	}
+
+	void SetUniform(int location, const glm::mat4& value) override
+	{
+		glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
+	}
+
+	void SetUniform(int location, int value) override
+	{
+		glUniform1i(location, value);
+	}
+
+	void CreateVertexArray(unsigned int& VAOID, unsigned int& VBOID) override
+	{
+		glGenVertexArrays(1, &VAOID);
+		glGenBuffers(1, &VBOID);
+
+		glBindVertexArray(VAOID);
+		glBindBuffer(GL_ARRAY_BUFFER, VBOID);
+
+		// VARFURILE SUNT float INDIFERENT DE Scalar (PLACA VIDEO OPEREAZA ORICUM IN float)
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
+		glEnableVertexAttribArray(0);
+		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
+		glEnableVertexAttribArray(1);
+	}
+
+	void DeleteVertexArray(unsigned int VAOID, unsigned int VBOID) override
+	{
+		glDeleteBuffers(1, &VBOID);
+		glDeleteVertexArrays(1, &VAOID);
+	}
+
+	void BindVertexArray(unsigned int VAOID) override
+	{
+		glBindVertexArray(VAOID);
+	}
+
+	void BindBuffer(unsigned int VBOID) override
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, VBOID);
+	}
+
+	void BufferData(const void* data, std::size_t bytes, BufferUsage usage) override
+	{
+		GLenum glUsage = GL_DYNAMIC_DRAW;
+
+		if (usage == BufferUsage::STATIC)
+		{
+			glUsage = GL_STATIC_DRAW;
+		}
+		else if (usage == BufferUsage::STREAM)
+		{
+			glUsage = GL_STREAM_DRAW;
+		}
+
+		glBufferData(GL_ARRAY_BUFFER, bytes, data, glUsage);
+	}
+
+	void BufferSubData(std::size_t offset, const void* data, std::size_t bytes) override
+	{
+		glBufferSubData(GL_ARRAY_BUFFER, offset, bytes, data);
+	}
+
+	unsigned int CreateTexture() override
+	{
+		unsigned int textureID;
+
+		glGenTextures(1, &textureID);
+		glBindTexture(GL_TEXTURE_2D, textureID);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		return textureID;
+	}
+
+	void UploadTexture(unsigned int textureID, int width, int height, const unsigned char* data) override
+	{
+		glBindTexture(GL_TEXTURE_2D, textureID);
+
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+		glGenerateMipmap(GL_TEXTURE_2D);
+	}
+
+	void ActiveTexture(int unit) override
+	{
+		glActiveTexture(GL_TEXTURE0 + unit);
+	}
+
+	void BindTexture(unsigned int textureID) override
+	{
+		glBindTexture(GL_TEXTURE_2D, textureID);
+	}
+
+	void SetBlending(bool enabled) override
+	{
+		if (enabled)
+		{
+			glEnable(GL_BLEND);
+			glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		}
+		else
+		{
+			glDisable(GL_BLEND);
+		}
+	}
+
+	void SetViewport(int x, int y, int width, int height) override
+	{
+		glViewport(x, y, width, height);
+	}
+
+	void DrawTriangles(int firstVertex, int vertexCount) override
+	{
+		glDrawArrays(GL_TRIANGLES, firstVertex, vertexCount);
+	}
+};
+
+enum class RenderCallType
+{
+	CREATE_PROGRAM,
+	DELETE_PROGRAM,
+	USE_PROGRAM,
+	SET_UNIFORM,
+	CREATE_VERTEX_ARRAY,
+	DELETE_VERTEX_ARRAY,
+	BIND_VERTEX_ARRAY,
+	BIND_BUFFER,
+	BUFFER_DATA,
+	BUFFER_SUB_DATA,
+	CREATE_TEXTURE,
+	UPLOAD_TEXTURE,
+	ACTIVE_TEXTURE,
+	BIND_TEXTURE,
+	SET_BLENDING,
+	SET_VIEWPORT,
+	DRAW,
+	COUNT,
+};
+
+// UN APEL INREGISTRAT. object E PROGRAMUL, VERTEX ARRAY-UL, BUFFER-UL (LEGAT, LA INCARCARI), TEXTURA, UNITATEA SAU LOCATIA UNIFORM-ULUI
+// LA INCARCARI first SI count SUNT DEPLASAMENTUL SI NUMARUL DE OCTETI, LA DESENARE PRIMUL VARF SI NUMARUL DE VARFURI
+struct RenderCall
+{
+	RenderCallType type;
+	unsigned int object;
+	long long first;
+	long long count;
+};
+
+// BACKEND FARA PLACA VIDEO: NU DESENEAZA NIMIC, DOAR INREGISTREAZA APELURILE SI LE NUMARA (PENTRU TESTE SI PENTRU MASURAREA COSTULUI PE PROCESOR)
+// ID-URILE INTOARSE SUNT UNICE, DAR NU INSEAMNA NIMIC PENTRU OpenGL
+class RecordingRenderBackend : public RenderBackend
+{
+public:
+
+	bool IsAvailable() override
+	{
+		return true;
+	}
+
+	unsigned int CreateProgram(const std::string&, const std::string&) override
+	{
+		unsigned int programID = this->nextObjectID++;
+		this->Record(RenderCallType::CREATE_PROGRAM, programID, 0, 0);
+
+		return programID;
+	}
+
+	void DeleteProgram(unsigned int programID) override
+	{
+		this->Record(RenderCallType::DELETE_PROGRAM, programID, 0, 0);
+	}
+
+	void UseProgram(unsigned int programID) override
+	{
+		this->Record(RenderCallType::USE_PROGRAM, programID, 0, 0);
+	}
+
+	// CA LA OpenGL, ACELASI NUME DIN ACELASI PROGRAM DA MEREU ACEEASI LOCATIE
+	int GetUniformLocation(unsigned int programID, const std::string& name) override
+	{
+		std::string key = std::to_string(programID) + " " + name;
+
+		std::unordered_map<std::string, int>::iterator it = this->uniformLocations.find(key);
+
+		if (it != this->uniformLocations.end())
+		{
+			return it->second;
+		}
+
+		int location = (int)this->uniformLocations.size();
+		this->uniformLocations[key] = location;
+
+		return location;
+	}
+
+	void SetUniform(int location, const glm::mat4&) override
+	{
+		this->Record(RenderCallType::SET_UNIFORM, location, 0, sizeof(glm::mat4));
+	}
+
+	void SetUniform(int location, int) override
+	{
+		this->Record(RenderCallType::SET_UNIFORM, location, 0, sizeof(int));
+	}
+
+	void CreateVertexArray(unsigned int& VAOID, unsigned int& VBOID) override
+	{
+		VAOID = this->nextObjectID++;
+		VBOID = this->nextObjectID++;
+
+		this->Record(RenderCallType::CREATE_VERTEX_ARRAY, VAOID, 0, 0);
+	}
+
+	void DeleteVertexArray(unsigned int VAOID, unsigned int) override
+	{
+		this->Record(RenderCallType::DELETE_VERTEX_ARRAY, VAOID, 0, 0);
+	}
+
+	void BindVertexArray(unsigned int VAOID) override
+	{
+		this->Record(RenderCallType::BIND_VERTEX_ARRAY, VAOID, 0, 0);
+	}
+
+	void BindBuffer(unsigned int VBOID) override
+	{
+		this->boundBuffer = VBOID;
+		this->Record(RenderCallType::BIND_BUFFER, VBOID, 0, 0);
+	}
+
+	void BufferData(const void*, std::size_t bytes, BufferUsage) override
+	{
+		this->uploadedBytes += bytes;
+		this->Record(RenderCallType::BUFFER_DATA, this->boundBuffer, 0, bytes);
+	}
+
+	void BufferSubData(std::size_t offset, const void*, std::size_t bytes) override
+	{
+		this->uploadedBytes += bytes;
+		this->Record(RenderCallType::BUFFER_SUB_DATA, this->boundBuffer, offset, bytes);
+	}
+
+	unsigned int CreateTexture() override
+	{
+		unsigned int textureID = this->nextObjectID++;
+		this->Record(RenderCallType::CREATE_TEXTURE, textureID, 0, 0);
+
+		return textureID;
+	}
+
+	void UploadTexture(unsigned int textureID, int width, int height, const unsigned char*) override
+	{
+		this->uploadedBytes += 4LL * width * height;
+		this->Record(RenderCallType::UPLOAD_TEXTURE, textureID, 0, 4LL * width * height);
+	}
+
+	void ActiveTexture(int unit) override
+	{
+		this->Record(RenderCallType::ACTIVE_TEXTURE, unit, 0, 0);
+	}
+
+	void BindTexture(unsigned int textureID) override
+	{
+		this->Record(RenderCallType::BIND_TEXTURE, textureID, 0, 0);
+	}
+
+	void SetBlending(bool enabled) override
+	{
+		this->Record(RenderCallType::SET_BLENDING, enabled ? 1 : 0, 0, 0);
+	}
+
+	// object E LATIMEA, first POZITIA (x * 65536 + y), count INALTIMEA
+	void SetViewport(int x, int y, int width, int height) override
+	{
+		this->Record(RenderCallType::SET_VIEWPORT, width, (long long)x * 65536 + y, height);
+	}
+
+	void DrawTriangles(int firstVertex, int vertexCount) override
+	{
+		this->drawnVertices += vertexCount;
+		this->Record(RenderCallType::DRAW, 0, firstVertex, vertexCount);
+	}
+
+	// FARA LISTA DE APELURI (DOAR NUMARATORII), CA SA NU CREASCA LA INFINIT IN BENCHMARK-URI LUNGI
+	void SetKeepsCalls(bool keepsCalls)
+	{
+		this->keepsCalls = keepsCalls;
+	}
+
+	const std::vector<RenderCall>& GetCalls()
+	{
+		return this->calls;
+	}
+
+	long long GetCallCount(RenderCallType type)
+	{
+		return this->callCounts[(int)type];
+	}
+
+	long long GetDrawCallCount()
+	{
+		return this->callCounts[(int)RenderCallType::DRAW];
+	}
+
+	long long GetUploadedBytes()
+	{
+		return this->uploadedBytes;
+	}
+
+	long long GetDrawnVertexCount()
+	{
+		return this->drawnVertices;
+	}
+
+	// STERGE APELURILE SI NUMARATORII (OBIECTELE CREATE RAMAN VALIDE)
+	void Reset()
+	{
+		this->calls.clear();
+		this->callCounts.fill(0);
+
+		this->uploadedBytes = 0;
+		this->drawnVertices = 0;
+	}
+
+private:
+
+	std::vector<RenderCall> calls;
+	std::array<long long, (int)RenderCallType::COUNT> callCounts = {};
+
+	bool keepsCalls = true;
+
+	long long uploadedBytes = 0;
+	long long drawnVertices = 0;
+
+	unsigned int nextObjectID = 1;
+	unsigned int boundBuffer = 0;
+
+	std::unordered_map<std::string, int> uniformLocations;
+
+	void Record(RenderCallType type, unsigned int object, long long first, long long count)
+	{
+		this->callCounts[(int)type]++;
+
+		if (this->keepsCalls)
+		{
+			this->calls.push_back({ type, object, first, count });
+		}
+	}
+};
+
+// CLASA RENDER STATE CACHE
+
+// STA IN FATA BACKEND-ULUI ALES SI TINE MINTE STAREA LEGATA (PROGRAMUL, VERTEX ARRAY-UL, BUFFER-UL, TEXTURA FIECAREI UNITATI, AMESTECAREA, VIEWPORT-UL).
+// SCHIMBARILE CARE NU SCHIMBA NIMIC NU MAI AJUNG LA BACKEND, DOAR SUNT NUMARATE. CELELALTE APELURI TREC NEMODIFICATE
+// STAREA E VALABILA CAT TIMP NIMENI NU OCOLESTE CACHE-UL (DACA SE APELEAZA OpenGL DIRECT, TREBUIE APELAT Invalidate())
+class RenderStateCache : public RenderBackend
+{
+public:
+
+	static RenderStateCache* Get()
+	{
+		assert(IsMainThread());
+
+		static RenderStateCache renderStateCache;
+
+		return &renderStateCache;
+	}
+
+	static constexpr int MAX_TEXTURE_UNITS = 16;
+
+	RenderBackend* GetTarget()
+	{
+		return this->target;
+	}
+
+	// UN BACKEND NOU INCEPE CU STAREA NECUNOSCUTA
+	void SetTarget(RenderBackend* target)
+	{
+		this->target = target;
+
+		this->Invalidate();
+	}
+
+	// DEZACTIVAT, RenderBackend::Get() INTOARCE DIRECT BACKEND-UL ALES
+	void SetEnabled(bool enabled)
+	{
+		this->isEnabled = enabled;
+
+		this->Invalidate();
+	}
+
+	bool IsEnabled()
+	{
+		return this->isEnabled;
+	}
+
+	// UITA STAREA, ASTFEL INCAT URMATOARELE SCHIMBARI SA AJUNGA SIGUR LA BACKEND
+	void Invalidate()
+	{
+		this->program = RenderStateCache::UNKNOWN;
+		this->vertexArray = RenderStateCache::UNKNOWN;
+		this->buffer = RenderStateCache::UNKNOWN;
+		this->activeTextureUnit = -1;
+		this->textures.fill(RenderStateCache::UNKNOWN);
+		this->blending = -1;
+		this->viewport.fill(-1);
+	}
+
+	long long GetSkippedCallCount(RenderCallType type)
+	{
+		return this->skippedCalls[(int)type];
+	}
+
+	long long GetSkippedCallCount()
+	{
+		long long skippedCallCount = 0;
+
+		for (int i = 0; i < this->skippedCalls.size(); i++)
+		{
+			skippedCallCount += this->skippedCalls[i];
+		}
+
+		return skippedCallCount;
+	}
+
+	void ResetStatistics()
+	{
+		this->skippedCalls.fill(0);
+	}
+
+	bool IsAvailable() override
+	{
+		return this->target->IsAvailable();
+	}
+
+	unsigned int CreateProgram(const std::string& vertexShaderCode, const std::string& fragmentShaderCode) override
+	{
+		return this->target->CreateProgram(vertexShaderCode, fragmentShaderCode);
+	}
+
+	void DeleteProgram(unsigned int programID) override
+	{
+		if (this->program == programID)
+		{
+			this->program = RenderStateCache::UNKNOWN;
+		}
+
+		this->target->DeleteProgram(programID);
+	}
+
+	void UseProgram(unsigned int programID) override
+	{
+		if (this->program == programID)
+		{
+			this->skippedCalls[(int)RenderCallType::USE_PROGRAM]++;
+
+			return;
+		}
+
+		this->program = programID;
+		this->target->UseProgram(programID);
+	}
+
+	int GetUniformLocation(unsigned int programID, const std::string& name) override
+	{
+		return this->target->GetUniformLocation(programID, name);
+	}
+
+	void SetUniform(int location, const glm::mat4& value) override
+	{
+		this->target->SetUniform(location, value);
+	}
+
+	void SetUniform(int location, int value) override
+	{
+		this->target->SetUniform(location, value);
+	}
+
+	void CreateVertexArray(unsigned int& VAOID, unsigned int& VBOID) override
+	{
+		this->target->CreateVertexArray(VAOID, VBOID);
+
+		this->vertexArray = VAOID;
+		this->buffer = VBOID;
+	}
+
+	void DeleteVertexArray(unsigned int VAOID, unsigned int VBOID) override
+	{
+		this->target->DeleteVertexArray(VAOID, VBOID);
+
+		// CA IN OpenGL, STERGEREA UNUI OBIECT LEGAT IL DEZLEAGA
+		if (this->vertexArray == VAOID)
+		{
+			this->vertexArray = 0;
+		}
+		if (this->buffer == VBOID)
+		{
+			this->buffer = 0;
+		}
+	}
+
+	void BindVertexArray(unsigned int VAOID) override
+	{
+		if (this->vertexArray == VAOID)
+		{
+			this->skippedCalls[(int)RenderCallType::BIND_VERTEX_ARRAY]++;
+
+			return;
+		}
+
+		this->vertexArray = VAOID;
+		this->target->BindVertexArray(VAOID);
+	}
+
+	void BindBuffer(unsigned int VBOID) override
+	{
+		if (this->buffer == VBOID)
+		{
+			this->skippedCalls[(int)RenderCallType::BIND_BUFFER]++;
+
+			return;
+		}
+
+		this->buffer = VBOID;
+		this->target->BindBuffer(VBOID);
+	}
+
+	void BufferData(const void* data, std::size_t bytes, BufferUsage usage) override
+	{
+		this->target->BufferData(data, bytes, usage);
+	}
+
+	void BufferSubData(std::size_t offset, const void* data, std::size_t bytes) override
+	{
+		this->target->BufferSubData(offset, data, bytes);
+	}
+
+	unsigned int CreateTexture() override
+	{
+		unsigned int textureID = this->target->CreateTexture();
+
+		this->SetBoundTexture(textureID);
+
+		return textureID;
+	}
+
+	void UploadTexture(unsigned int textureID, int width, int height, const unsigned char* data) override
+	{
+		this->target->UploadTexture(textureID, width, height, data);
+
+		this->SetBoundTexture(textureID);
+	}
+
+	void ActiveTexture(int unit) override
+	{
+		if (this->activeTextureUnit == unit)
+		{
+			this->skippedCalls[(int)RenderCallType::ACTIVE_TEXTURE]++;
+
+			return;
+		}
+
+		this->activeTextureUnit = unit;
+		this->target->ActiveTexture(unit);
+	}
+
+	void BindTexture(unsigned int textureID) override
+	{
+		if (this->activeTextureUnit >= 0 && this->activeTextureUnit < RenderStateCache::MAX_TEXTURE_UNITS && this->textures[this->activeTextureUnit] == textureID)
+		{
+			this->skippedCalls[(int)RenderCallType::BIND_TEXTURE]++;
+
+			return;
+		}
+
+		this->SetBoundTexture(textureID);
+		this->target->BindTexture(textureID);
+	}
+
+	void SetBlending(bool enabled) override
+	{
+		if (this->blending == (enabled ? 1 : 0))
+		{
+			this->skippedCalls[(int)RenderCallType::SET_BLENDING]++;
+
+			return;
+		}
+
+		this->blending = enabled ? 1 : 0;
+		this->target->SetBlending(enabled);
+	}
+
+	void SetViewport(int x, int y, int width, int height) override
+	{
+		std::array<int, 4> viewport = { x, y, width, height };
+
+		if (this->viewport == viewport)
+		{
+			this->skippedCalls[(int)RenderCallType::SET_VIEWPORT]++;
+
+			return;
+		}
+
+		this->viewport = viewport;
+		this->target->SetViewport(x, y, width, height);
+	}
+
+	void DrawTriangles(int firstVertex, int vertexCount) override
+	{
+		this->target->DrawTriangles(firstVertex, vertexCount);
+	}
+
+private:
+
+	static constexpr unsigned int UNKNOWN = 0xFFFFFFFF;
+
+	RenderBackend* target = nullptr;
+	bool isEnabled = true;
+
+	unsigned int program = RenderStateCache::UNKNOWN;
+	unsigned int vertexArray = RenderStateCache::UNKNOWN;
+	unsigned int buffer = RenderStateCache::UNKNOWN;
+	int activeTextureUnit = -1; // -1 NECUNOSCUTA
+	std::array<unsigned int, MAX_TEXTURE_UNITS> textures;
+	int blending = -1; // -1 NECUNOSCUTA
+	std::array<int, 4> viewport; // -1 NECUNOSCUT
+
+	std::array<long long, (int)RenderCallType::COUNT> skippedCalls = {};
+
+	void SetBoundTexture(unsigned int textureID)
+	{
+		if (this->activeTextureUnit >= 0 && this->activeTextureUnit < RenderStateCache::MAX_TEXTURE_UNITS)
+		{
+			this->textures[this->activeTextureUnit] = textureID;
+		}
+	}
+
+	RenderStateCache()
+	{
+		this->Invalidate();
+	};
+
+	RenderStateCache(const RenderStateCache&) = delete;
+};
+
+inline RenderBackend* RenderBackend::GetTarget()
+{
+	assert(IsMainThread());
+
+	static GLRenderBackend glRenderBackend;
+
+	if (RenderBackend::current == nullptr)
+	{
+		return &glRenderBackend;
+	}
+
+	return RenderBackend::current;
+}
+
+inline RenderBackend* RenderBackend::Get()
+{
+	RenderBackend* target = RenderBackend::GetTarget();
+	RenderStateCache* renderStateCache = RenderStateCache::Get();
+
+	if (!renderStateCache->IsEnabled())
+	{
+		return target;
+	}
+
+	if (renderStateCache->GetTarget() != target)
+	{
+		renderStateCache->SetTarget(target);
+	}
+
+	return renderStateCache;
+}
+
+// CLASA ASSET MANAGER
+
+class AssetManager
+{
+public:
+
+	static AssetManager* Get()
+	{
+		if (AssetManager::instance == nullptr)
+		{
+			AssetManager::instance = new AssetManager();
+		}
+
+		return AssetManager::instance;
+	}
+
+	void ClearTextureData()
+	{
+		this->textures.clear();
+	}
+
+	void AddTexture(std::string name, std::string address)
+	{
+		Texture texture;
+
+		texture.ID = RenderBackend::Get()->CreateTexture();
+
+		unsigned char* data = SOIL_load_image(address.c_str(), &texture.width, &texture.height, &texture.nrChannels, 0);
+
+		if (data)
+		{
+			RenderBackend::Get()->UploadTexture(texture.ID, texture.width, texture.height, data);
+
+			this->textures.insert({ name, texture });
+		}
+		else
+		{
+			std::cout << "ERROR :: ASSET MANAGER :: ADDTEXTURE :: COULD NOT FIND THE TEXTURED NAMED \"" << name << "\" AT THE ADDRESS \"" << address << "\"\n";
+		}
+
+		SOIL_free_image_data(data);
+	}
+
+	void DeleteTexture(std::string name)
+	{
+		this->textures.erase(name);
+	}
+
+	unsigned int GetTextureID(std::string name)
+	{
+		if (this->textures.find(name) == this->textures.end())
+		{
+			std::cout << "ERROR :: ASSET MANAGER :: GETTEXTUREID :: COULD NOT FIND THE TEXTURE NAMED \"" << name << "\". RETURNING ERROR TEXTURE ID INSTEAD...\n";
+
+			return this->errorTexture.ID;
+		}
+
+		return this->textures[name].ID;
+
+	}
+
+	unsigned int GetErrorTextureID()
+	{
+		return this->errorTexture.ID;
+	}
+
+private:
+
+	static AssetManager* instance;
+
+	Texture errorTexture;
+	std::unordered_map<std::string, Texture> textures;
+
+	std::string errorTextureAddress = "GameEngine/Textures/ErrorTexture/ErrorTexture.png";
+
+	AssetManager()
+	{
+		this->errorTexture.ID = RenderBackend::Get()->CreateTexture();
+
+		unsigned char* data = SOIL_load_image(this->errorTextureAddress.c_str(), &this->errorTexture.width, &this->errorTexture.height, &this->errorTexture.nrChannels, 0);
+
+		if (data)
+		{
+			RenderBackend::Get()->UploadTexture(this->errorTexture.ID, this->errorTexture.width, this->errorTexture.height, data);
+		}
+		else
+		{
+			std::cout << "ERROR :: ASSET MANAGER :: COULD NOT FIND THE ERROR TEXTURE AT THE ADDRESS \"" << this->errorTextureAddress << "\"\n";
+		}
+
+		SOIL_free_image_data(data);
+	};
+
+	AssetManager(const AssetManager&) = delete;
+};
+
+AssetManager* AssetManager::instance = nullptr;
+
+// CLASA RENDERER2D
+
+class Renderer2D
+{
+public:
+
+	Renderer2D(std::string vertexShaderAddress, std::string fragmentShaderAddress) : rendererIndex(Renderer2D::lastRendererIndex++)
+	{
+
+		std::ifstream fileInput;
+		std::string line;
+
+		fileInput.open(vertexShaderAddress);
+
+		if (fileInput)
+		{
+			while (!fileInput.eof())
+			{
+				getline(fileInput, line);
+
+				this->vertexShaderCode += line;
+				this->vertexShaderCode += "\n";
+			}
+
+			this->vertexShaderCode += "\0";
+		}
+		else
+		{
+			std::cout << "ERROR :: RENDERER2D :: COULD NOT FIND ANY FILE AT THE ADDRESS \"" << vertexShaderAddress << "\" WHICH CONTAINS THE VERTEX SHADER CODE\n";
+		}
+
+		fileInput.close();
+
+		fileInput.open(fragmentShaderAddress);
+
+		if (fileInput)
+		{
+			while (!fileInput.eof())
+			{
+				getline(fileInput, line);
+
+				this->fragmentShaderCode += line;
+				this->fragmentShaderCode += "\n";
+			}
+
+			this->fragmentShaderCode += "\0";
+		}
+		else
+		{
+			std::cout << "ERROR :: RENDERER2D :: COULD NOT FIND ANY FILE AT THE ADDRESS \"" << fragmentShaderAddress << "\" WHICH CONTAINS THE FRAGMENT SHADER CODE\n";
+		}
+
+		fileInput.close();
+
+		RenderBackend* backend = RenderBackend::Get();
+
+		this->programID = backend->CreateProgram(this->vertexShaderCode, this->fragmentShaderCode);
+
+		backend->UseProgram(this->programID);
+
+		this->ortho = glm::ortho(0.0, 1.0 * WindowManager::Get()->GetWindowWidth(), 0.0, 1.0 * WindowManager::Get()->GetWindowHeight());
+		this->orthoPath = backend->GetUniformLocation(this->programID, "ortho");
+		backend->SetUniform(this->orthoPath, this->ortho);
+
+		this->texturePath = backend->GetUniformLocation(this->programID, "texture0");
+		backend->SetUniform(this->texturePath, 0);
+
+		backend->ActiveTexture(0);
+
+		backend->UseProgram(0);
+	}
+
+	~Renderer2D()
+	{
+		RenderBackend::Get()->DeleteProgram(this->programID);
+	}
+
+	inline void StartUsing()
+	{
+		RenderBackend::Get()->UseProgram(this->programID);
+	}
+
+	inline void StopUsing()
+	{
+		RenderBackend::Get()->UseProgram(0);
+	}
+
+	unsigned int GetProgramID()
+	{
+		return this->programID;
+	}
+
+	// NUMARUL DE ORDINE AL RENDERER-ULUI, FOLOSIT IN CHEIA DE SORTARE A COZII DE RANDARE (programID E CUNOSCUT DOAR DUPA CREAREA CONTEXTULUI)
+	int GetRendererIndex()
+	{
+		return this->rendererIndex;
+	}
+
+	// VARFURILE SUNT IN COORDONATELE LUMII, IAR CAMERA E APLICATA DE SHADER, PRIN UNIFORM-UL ortho (PROGRAMUL TREBUIE SA FIE IN FOLOSINTA)
+	void SetViewProjection(const glm::mat4& viewProjection)
+	{
+		RenderBackend::Get()->SetUniform(this->orthoPath, viewProjection);
+	}
+
+private:
+
+	static std::atomic<int> lastRendererIndex;
+
+	int rendererIndex;
+
+	unsigned int programID;
+
+	std::string vertexShaderCode;
+	std::string fragmentShaderCode;
+
+	int orthoPath;
+	glm::mat4 ortho;
+
+	int texturePath;
+};
+
+std::atomic<int> Renderer2D::lastRendererIndex(0);
+
+// CLASA CAMERA 2D
+
+// CE PARTE A LUMII SE VEDE SI UNDE IN FEREASTRA. CAMERA E DATA SHADER-ULUI CA O SINGURA MATRICE, DECI VARFURILE SPRITE-URILOR NU DEPIND DE EA
+class Camera2D
+{
+public:
+
+	Camera2D() {};
+
+	// MUTA CAMERA DIRECT, FARA NETEZIRE
+	void SetPosition(Scalar x, Scalar y)
+	{
+		this->isPositioned = true;
+
+		this->x = x;
+		this->y = y;
+		this->targetX = x;
+		this->targetY = y;
+	}
+
+	// CAMERA URMARESTE POZITIA ENTITATII (nullptr OPRESTE URMARIREA). ENTITATEA TREBUIE SCOASA DE AICI INAINTE SA FIE STEARSA
+	void Follow(Entity* entity)
+	{
+		this->followedEntity = entity;
+	}
+
+	Entity* GetFollowedEntity()
+	{
+		return this->followedEntity;
+	}
+
+	// URMARESTE ENTITATEA DIN Player CAT TIMP Player::ShouldCameraFollowPlayer() (IMPLICIT DOAR PENTRU CAMERA PRINCIPALA)
+	void SetFollowsPlayer(bool followsPlayer)
+	{
+		this->followsPlayer = followsPlayer;
+	}
+
+	// MAI MARE DE 1 APROPIE
+	void SetZoom(double zoom)
+	{
+		if (zoom <= 0.0)
+		{
+			std::cout << "ERROR :: CAMERA2D :: SETZOOM :: THE ZOOM MUST BE POSITIVE\n";
+
+			return;
+		}
+
+		this->zoom = zoom;
+	}
+
+	// IN CAT TIMP (SECUNDE) RECUPEREAZA CAMERA CAM 63% DIN DISTANTA PANA LA TINTA. 0 O MUTA IMEDIAT
+	void SetSmoothing(double smoothing)
+	{
+		this->smoothing = std::max(0.0, smoothing);
+	}
+
+	// CAMERA NU ARATA NIMIC DIN AFARA DREPTUNGHIULUI (DACA E MAI MIC DECAT CE SE VEDE, IL CENTREAZA)
+	void SetBounds(Scalar minX, Scalar minY, Scalar maxX, Scalar maxY)
+	{
+		this->hasBounds = true;
+
+		this->minX = minX;
+		this->minY = minY;
+		this->maxX = maxX;
+		this->maxY = maxY;
+	}
+
+	void ClearBounds()
+	{
+		this->hasBounds = false;
+	}
+
+	// PARTEA FERESTREI IN CARE DESENEAZA CAMERA, CA FRACTIUNI DIN FEREASTRA (0, 0, 1, 1 E TOATA FEREASTRA)
+	void SetViewport(double left, double bottom, double width, double height)
+	{
+		this->viewportLeft = left;
+		this->viewportBottom = bottom;
+		this->viewportWidth = width;
+		this->viewportHeight = height;
+	}
+
+	void SetActive(bool isActive)
+	{
+		this->isActive = isActive;
+	}
+
+	bool IsActive()
+	{
+		return this->isActive;
+	}
+
+	// APROPIE CAMERA DE TINTA SI O TINE IN LIMITE. DEFINIT DUPA Entity
+	void Update(double deltaTime);
+
+	// DUPA MUTAREA ORIGINII LUMII
+	void Move(Scalar offsetX, Scalar offsetY)
+	{
+		this->PlaceIfNeeded();
+
+		this->x += offsetX;
+		this->y += offsetY;
+		this->targetX += offsetX;
+		this->targetY += offsetY;
+
+		if (this->hasBounds)
+		{
+			this->minX += offsetX;
+			this->minY += offsetY;
+			this->maxX += offsetX;
+			this->maxY += offsetY;
+		}
+	}
+
+	Scalar GetX()
+	{
+		this->PlaceIfNeeded();
+
+		return this->x;
+	}
+
+	Scalar GetY()
+	{
+		this->PlaceIfNeeded();
+
+		return this->y;
+	}
+
+	double GetZoom()
+	{
+		return this->zoom;
+	}
+
+	// DREPTUNGHIUL LUMII CARE SE VEDE
+	void GetVisibleArea(double& left, double& bottom, double& right, double& top)
+	{
+		this->PlaceIfNeeded();
+
+		double halfWidth = this->viewportWidth * WindowManager::Get()->GetWindowWidth() / (2.0 * this->zoom);
+		double halfHeight = this->viewportHeight * WindowManager::Get()->GetWindowHeight() / (2.0 * this->zoom);
+
+		left = this->x - halfWidth;
+		right = this->x + halfWidth;
+		bottom = this->y - halfHeight;
+		top = this->y + halfHeight;
+	}
+
+	glm::mat4 GetViewProjection()
+	{
+		double left, bottom, right, top;
+		this->GetVisibleArea(left, bottom, right, top);
+
+		return glm::ortho(left, right, bottom, top);
+	}
+
+	void GetViewportPixels(int& x, int& y, int& width, int& height)
+	{
+		x = (int)std::round(this->viewportLeft * WindowManager::Get()->GetWindowWidth());
+		y = (int)std::round(this->viewportBottom * WindowManager::Get()->GetWindowHeight());
+		width = (int)std::round(this->viewportWidth * WindowManager::Get()->GetWindowWidth());
+		height = (int)std::round(this->viewportHeight * WindowManager::Get()->GetWindowHeight());
+	}
+
+private:
+
+	bool isPositioned = false;
+
+	Scalar x = 0.0;
+	Scalar y = 0.0;
+
+	Scalar targetX = 0.0;
+	Scalar targetY = 0.0;
+
+	Entity* followedEntity = nullptr;
+	bool followsPlayer = false;
+
+	double zoom = 1.0;
+	double smoothing = 0.0;
+
+	bool hasBounds = false;
+	Scalar minX = 0.0;
+	Scalar minY = 0.0;
+	Scalar maxX = 0.0;
+	Scalar maxY = 0.0;
+
+	double viewportLeft = 0.0;
+	double viewportBottom = 0.0;
+	double viewportWidth = 1.0;
+	double viewportHeight = 1.0;
+
+	bool isActive = true;
+
+	// IMPLICIT, PUNCTUL (x, y) AL LUMII APARE LA PIXELUL (x, y) AL FERESTREI (CA INAINTE DE CAMERE).
+	// CENTRUL E LUAT LA PRIMA FOLOSIRE, CA SA FIE CEL AL FERESTREI CREATE, NU AL CELEI IMPLICITE
+	void PlaceIfNeeded()
+	{
+		if (this->isPositioned)
+		{
+			return;
+		}
+
+		this->isPositioned = true;
+
+		this->x = WindowManager::Get()->GetWindowWidth() / 2.0;
+		this->y = WindowManager::Get()->GetWindowHeight() / 2.0;
+		this->targetX = this->x;
+		this->targetY = this->y;
+	}
+
+	void ClampToBounds()
+	{
+		if (!this->hasBounds)
+		{
+			return;
+		}
+
+		double halfWidth = this->viewportWidth * WindowManager::Get()->GetWindowWidth() / (2.0 * this->zoom);
+		double halfHeight = this->viewportHeight * WindowManager::Get()->GetWindowHeight() / (2.0 * this->zoom);
+
+		if (this->maxX - this->minX <= 2.0 * halfWidth)
+		{
+			this->x = (this->minX + this->maxX) / 2.0;
+		}
+		else
+		{
+			this->x = std::max((double)this->minX + halfWidth, std::min((double)this->maxX - halfWidth, (double)this->x));
+		}
+
+		if (this->maxY - this->minY <= 2.0 * halfHeight)
+		{
+			this->y = (this->minY + this->maxY) / 2.0;
+		}
+		else
+		{
+			this->y = std::max((double)this->minY + halfHeight, std::min((double)this->maxY - halfHeight, (double)this->y));
+		}
+	}
+};
+
+// CLASA CAMERA MANAGER
+
+// CAMERELE UNEI LUMI. CAMERA PRINCIPALA EXISTA MEREU SI URMARESTE JUCATORUL CAND Player::ShouldCameraFollowPlayer().
+// RenderQueue DESENEAZA TOT CE S-A TRIMIS O DATA PENTRU FIECARE CAMERA ACTIVA, IN ORDINEA ADAUGARII
+class CameraManager
+{
+public:
+
+	static CameraManager* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->cameraManager == nullptr)
+		{
+			world->cameraManager = new CameraManager();
+		}
+
+		return world->cameraManager;
+	}
+
+	~CameraManager()
+	{
+		for (int i = 0; i < this->cameras.size(); i++)
+		{
+			delete this->cameras[i];
+		}
+	}
+
+	Camera2D* GetMainCamera()
+	{
+		return this->cameras[0];
+	}
+
+	// O CAMERA NOUA, PE TOATA FEREASTRA (DE OBICEI I SE DA UN VIEWPORT, CA SA NU ACOPERE CAMERA PRINCIPALA)
+	Camera2D* AddCamera()
+	{
+		Camera2D* camera = new Camera2D();
+		this->cameras.push_back(camera);
+
+		return camera;
+	}
+
+	void RemoveCamera(Camera2D* camera)
+	{
+		if (camera == this->cameras[0])
+		{
+			std::cout << "ERROR :: CAMERA MANAGER :: REMOVECAMERA :: THE MAIN CAMERA CANNOT BE REMOVED. DEACTIVATE IT INSTEAD\n";
+
+			return;
+		}
+
+		for (int i = 1; i < this->cameras.size(); i++)
+		{
+			if (this->cameras[i] == camera)
+			{
+				delete camera;
+				this->cameras.erase(this->cameras.begin() + i);
+
+				return;
+			}
+		}
+	}
+
+	int GetCameraCount()
+	{
+		return (int)this->cameras.size();
+	}
+
+	Camera2D* GetCamera(int index)
+	{
+		return this->cameras[index];
+	}
+
+	void UpdateCameras(double deltaTime)
+	{
+		for (int i = 0; i < this->cameras.size(); i++)
+		{
+			this->cameras[i]->Update(deltaTime);
+		}
+	}
+
+	void MoveCameras(Scalar offsetX, Scalar offsetY)
+	{
+		for (int i = 0; i < this->cameras.size(); i++)
+		{
+			this->cameras[i]->Move(offsetX, offsetY);
+		}
+	}
+
+private:
+
+	std::vector<Camera2D*> cameras;
+
+	CameraManager()
+	{
+		this->cameras.push_back(new Camera2D());
+		this->cameras[0]->SetFollowsPlayer(true);
+	};
+
+	CameraManager(const CameraManager&) = delete;
+};
+
+// CLASA RENDER QUEUE
+
+enum class RenderCommandType
+{
+	SET_CAMERA, // DE AICI INCOLO SE DESENEAZA PENTRU CAMERA CU INDICELE value
+	USE_PROGRAM,
+	BIND_TEXTURE,
+	UPLOAD_STATIC, // VARFURI RESCRISE IN BUFFER-UL PERSISTENT AL SPRITE-URILOR STATICE
+	UPLOAD_DYNAMIC, // VARFURILE SPRITE-URILOR DINAMICE SI ALE FUNDALURILOR, TRIMISE DIN NOU IN FIECARE CADRU
+	DRAW,
+};
+
+// O COMANDA EMISA LA GOLIREA COZII. LISTA RAMANE DISPONIBILA DUPA Flush, CA SA POATA FI VERIFICATA SI FARA FEREASTRA
+struct RenderCommand
+{
+	RenderCommandType type;
+	unsigned int value; // PROGRAMUL, TEXTURA, CATE SPRITE-URI SUNT TRIMISE SAU DESENATE
+	unsigned long long key; // CHEIA PRIMULUI SPRITE LA CARE SE REFERA COMANDA (0 PENTRU INCARCARI)
+};
+
+// SPRITE-URILE TRIMISE DE Render2D::Render IN TIMPUL CADRULUI SUNT DESENATE ABIA LA Flush (APELAT DE GameEngine::Update INAINTE DE SCHIMBAREA BUFFERELOR),
+// IN ORDINEA CHEII DE SORTARE. SPRITE-URILE CONSECUTIVE CU ACELASI SHADER SI ACEEASI TEXTURA SUNT DESENATE CU UN SINGUR APEL
+// SPRITE-URILE CARE NU SE MAI SCHIMBA (VEZI Render2D) STAU INTR-UN BUFFER PERSISTENT, ASEZAT IN ORDINEA DE DESENARE, RESCRIS DOAR UNDE S-A SCHIMBAT CEVA.
+// CELELALTE SUNT TRIMISE IMPREUNA, CU O SINGURA INCARCARE PE CADRU
+// TOTUL E DESENAT O DATA PENTRU FIECARE CAMERA ACTIVA (VEZI CameraManager), IN VIEWPORT-UL EI. VARFURILE SUNT ACELEASI, SE SCHIMBA DOAR MATRICEA DIN SHADER
+class RenderQueue
+{
+public:
+
+	static RenderQueue* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->renderQueue == nullptr)
+		{
+			world->renderQueue = new RenderQueue();
+		}
+
+		return world->renderQueue;
+	}
+
+	~RenderQueue()
+	{
+		// DACA BACKEND-UL S-A SCHIMBAT INTRE TIMP, CEL VECHI POATE SA NU MAI EXISTE, IAR BUFFERELE SUNT TREABA LUI
+		if (this->bufferBackend != nullptr && this->bufferBackend == RenderBackend::GetTarget())
+		{
+			RenderBackend::Get()->DeleteVertexArray(this->staticVAOID, this->staticVBOID);
+			RenderBackend::Get()->DeleteVertexArray(this->dynamicVAOID, this->dynamicVBOID);
+		}
+	}
+
+	static constexpr int VERTEX_DATA_SIZE = 24; // 6 VARFURI * (x, y, u, v)
+
+	static constexpr int MIN_LAYER = -128;
+	static constexpr int MAX_LAYER = 127;
+	static constexpr int MAX_DEPTH = (1 << 16) - 1;
+
+	// CHEIA, DE LA BITII CEI MAI SEMNIFICATIVI: STRATUL (8), SHADER-UL (16), TEXTURA (24), ADANCIMEA (16)
+	// ORDINEA INTRE TEXTURI DIFERITE E GARANTATA DOAR DE STRAT. LA CHEI EGALE SE PASTREAZA ORDINEA TRIMITERII
+	static unsigned long long MakeKey(int layer, int rendererIndex, unsigned int textureID, int depth)
+	{
+		layer = std::max(RenderQueue::MIN_LAYER, std::min(RenderQueue::MAX_LAYER, layer));
+		depth = std::max(0, std::min(RenderQueue::MAX_DEPTH, depth));
+
+		return ((unsigned long long)(layer - RenderQueue::MIN_LAYER) << 56)
+			| ((unsigned long long)(rendererIndex & 0xFFFF) << 40)
+			| ((unsigned long long)(textureID & 0xFFFFFF) << 16)
+			| (unsigned long long)depth;
+	}
+
+	// data POATE FI nullptr DOAR PENTRU UN SPRITE STATIC NESCHIMBAT, TRIMIS (TOT STATIC) SI LA Flush-UL TRECUT: VARFURILE LUI SUNT DEJA IN BUFFER
+	// owner IDENTIFICA SPRITE-UL INTRE CADRE
+	void Submit(Renderer2D* renderer2D, unsigned int textureID, int layer, int depth, const Entity* owner, bool isStatic, const float* data)
+	{
+		if (renderer2D == nullptr)
+		{
+			std::cout << "ERROR :: RENDER QUEUE :: SUBMIT :: THERE IS NO RENDERER. THE SPRITE WILL NOT BE DRAWN\n";
+
+			return;
+		}
+
+		RenderItem item;
+		item.key = RenderQueue::MakeKey(layer, renderer2D->GetRendererIndex(), textureID, depth);
+		item.renderer = renderer2D;
+		item.textureID = textureID;
+		item.owner = owner;
+		item.isStatic = isStatic;
+		item.dataOffset = -1;
+		item.slot = -1;
+		item.background = -1;
+
+		if (data != nullptr)
+		{
+			item.dataOffset = (int)this->vertexData.size();
+			this->vertexData.insert(this->vertexData.end(), data, data + RenderQueue::VERTEX_DATA_SIZE);
+		}
+
+		this->items.push_back(item);
+	}
+
+	// UN FUNDAL CARE SE REPETA SI ACOPERA TOT CE VEDE FIECARE CAMERA (VEZI Parallax2D). DREPTUNGHIUL E CALCULAT LA Flush, PENTRU FIECARE CAMERA ACTIVA:
+	// TEXTURA E DERULATA CU (MARGINEA CAMEREI) * factor + scrollBase
+	void SubmitBackground(Renderer2D* renderer2D, unsigned int textureID, int layer, int depth, const Entity* owner,
+		double tileWidth, double tileHeight, double factorX, double factorY, double scrollBaseX, double scrollBaseY)
+	{
+		if (renderer2D == nullptr)
+		{
+			std::cout << "ERROR :: RENDER QUEUE :: SUBMITBACKGROUND :: THERE IS NO RENDERER. THE BACKGROUND WILL NOT BE DRAWN\n";
+
+			return;
+		}
+
+		if (tileWidth <= 0.0 || tileHeight <= 0.0)
+		{
+			std::cout << "ERROR :: RENDER QUEUE :: SUBMITBACKGROUND :: THE TILE SIZE MUST BE POSITIVE. THE BACKGROUND WILL NOT BE DRAWN\n";
+
+			return;
+		}
+
+		RenderItem item;
+		item.key = RenderQueue::MakeKey(layer, renderer2D->GetRendererIndex(), textureID, depth);
+		item.renderer = renderer2D;
+		item.textureID = textureID;
+		item.owner = owner;
+		item.isStatic = false;
+		item.dataOffset = -1;
+		item.slot = -1;
+		item.background = (int)this->backgrounds.size();
+
+		this->backgrounds.push_back({ tileWidth, tileHeight, factorX, factorY, scrollBaseX, scrollBaseY });
+
+		this->items.push_back(item);
+	}
+
+	// SORTEAZA SI DESENEAZA TOT CE S-A TRIMIS, APOI GOLESTE COADA. DACA BACKEND-UL NU E DISPONIBIL (OpenGL FARA FEREASTRA) DOAR EMITE COMENZILE
+	void Flush()
+	{
+		this->commands.clear();
+		this->lastFlushSpriteCount = (int)this->items.size();
+		this->lastFlushUploadedBytes = 0;
+
+		this->SortItems();
+
+		RenderBackend* backend = RenderBackend::Get();
+		bool executes = backend->IsAvailable();
+
+		// BUFFERELE SUNT ALE BACKEND-ULUI CARE LE-A CREAT. DACA ACESTA S-A SCHIMBAT, SUNT CREATE DIN NOU SI BUFFER-UL STATIC E RECONSTRUIT
+		if (executes && this->bufferBackend != RenderBackend::GetTarget())
+		{
+			backend->CreateVertexArray(this->staticVAOID, this->staticVBOID);
+			backend->CreateVertexArray(this->dynamicVAOID, this->dynamicVBOID);
+
+			this->bufferBackend = RenderBackend::GetTarget();
+
+			this->staticOwners.clear();
+			this->staticKeys.clear();
+		}
+
+		if (executes)
+		{
+			backend->SetBlending(this->usesBlending);
+		}
+
+		this->activeCameras.clear();
+		for (int i = 0; i < CameraManager::Get()->GetCameraCount(); i++)
+		{
+			if (CameraManager::Get()->GetCamera(i)->IsActive())
+			{
+				this->activeCameras.push_back(i);
+			}
+		}
+
+		this->UpdateStaticBuffer(backend, executes);
+		this->UpdateDynamicBuffer(backend, executes);
+
+		long long drawCalls = 0;
+
+		for (int cameraIndex = 0; cameraIndex < this->activeCameras.size(); cameraIndex++)
+		{
+			Camera2D* camera = CameraManager::Get()->GetCamera(this->activeCameras[cameraIndex]);
+
+			this->commands.push_back({ RenderCommandType::SET_CAMERA, (unsigned int)this->activeCameras[cameraIndex], 0 });
+
+			glm::mat4 viewProjection = camera->GetViewProjection();
+
+			if (executes)
+			{
+				int viewportX, viewportY, viewportWidth, viewportHeight;
+				camera->GetViewportPixels(viewportX, viewportY, viewportWidth, viewportHeight);
+
+				backend->SetViewport(viewportX, viewportY, viewportWidth, viewportHeight);
+			}
+
+			// MATRICEA E UN UNIFORM AL FIECARUI PROGRAM, DECI LA O CAMERA NOUA FIECARE PROGRAM E FOLOSIT DIN NOU SI PRIMESTE MATRICEA EI
+			Renderer2D* currentRenderer = nullptr;
+			unsigned int currentTextureID = 0;
+			bool hasTexture = false;
+			int currentRegion = -1; // 0 STATIC, 1 DINAMIC
+
+			int first = 0;
+
+			while (first < this->items.size())
+			{
+				const RenderItem& firstItem = this->items[first];
+
+				// FUNDALURILE AU CATE UN DREPTUNGHI PENTRU FIECARE CAMERA, DECI SUNT DESENATE SEPARAT
+				int last = first + 1;
+				while (firstItem.background == -1 && last < this->items.size() && this->items[last].background == -1
+					&& this->items[last].renderer == firstItem.renderer && this->items[last].textureID == firstItem.textureID
+					&& this->items[last].isStatic == firstItem.isStatic && this->items[last].slot == this->items[last - 1].slot + 1)
+				{
+					last++;
+				}
+
+				if (firstItem.renderer != currentRenderer)
+				{
+					this->commands.push_back({ RenderCommandType::USE_PROGRAM, (unsigned int)firstItem.renderer->GetRendererIndex(), firstItem.key });
+
+					if (executes)
+					{
+						firstItem.renderer->StartUsing();
+						firstItem.renderer->SetViewProjection(viewProjection);
+					}
+
+					currentRenderer = firstItem.renderer;
+				}
+
+				if (!hasTexture || firstItem.textureID != currentTextureID)
+				{
+					this->commands.push_back({ RenderCommandType::BIND_TEXTURE, firstItem.textureID, firstItem.key });
+
+					if (executes)
+					{
+						backend->BindTexture(firstItem.textureID);
+					}
+
+					currentTextureID = firstItem.textureID;
+					hasTexture = true;
+				}
+
+				this->commands.push_back({ RenderCommandType::DRAW, (unsigned int)(last - first), firstItem.key });
+
+				MetricsRegistry::Get()->Record(Metric::SPRITES_PER_DRAW, (double)(last - first));
+				drawCalls++;
+
+				if (executes)
+				{
+					int region = firstItem.isStatic ? 0 : 1;
+
+					if (region != currentRegion)
+					{
+						backend->BindVertexArray(firstItem.isStatic ? this->staticVAOID : this->dynamicVAOID);
+
+						currentRegion = region;
+					}
+
+					int slot = firstItem.slot;
+					if (firstItem.background != -1)
+					{
+						slot += cameraIndex * (int)this->backgrounds.size();
+					}
+
+					backend->DrawTriangles(slot * 6, (last - first) * 6);
+				}
+
+				first = last;
+			}
+		}
+
+		this->Clear();
+
+		this->flushCount++;
+
+		MetricsRegistry::Get()->Add(Metric::SPRITES_SUBMITTED, this->lastFlushSpriteCount);
+		MetricsRegistry::Get()->Add(Metric::DRAW_CALLS, drawCalls);
+		MetricsRegistry::Get()->Add(Metric::UPLOADED_BYTES, this->lastFlushUploadedBytes);
+	}
+
+	// SPRITE-URI CU TRANSPARENTA, AMESTECATE CU CE E DEJA DESENAT (IMPLICIT NU)
+	void SetBlending(bool usesBlending)
+	{
+		this->usesBlending = usesBlending;
+	}
+
+	// RENUNTA LA CE S-A TRIMIS, FARA SA DESENEZE
+	void Clear()
+	{
+		this->items.clear();
+		this->vertexData.clear();
+		this->backgrounds.clear();
+	}
+
+	const std::vector<RenderCommand>& GetCommands()
+	{
+		return this->commands;
+	}
+
+	// CATE Flush-URI S-AU FACUT (Render2D IL FOLOSESTE CA SA STIE DACA A FOST TRIMIS SI IN CADRUL TRECUT)
+	long long GetFlushCount()
+	{
+		return this->flushCount;
+	}
+
+	int GetPendingSpriteCount()
+	{
+		return (int)this->items.size();
+	}
+
+	int GetLastFlushSpriteCount()
+	{
+		return this->lastFlushSpriteCount;
+	}
+
+	int GetStaticSpriteCount()
+	{
+		return (int)this->staticOwners.size();
+	}
+
+	long long GetLastFlushUploadedBytes()
+	{
+		return this->lastFlushUploadedBytes;
+	}
+
+private:
+
+	struct RenderItem
+	{
+		unsigned long long key;
+		Renderer2D* renderer;
+		unsigned int textureID;
+		const Entity* owner;
+		bool isStatic;
+		int dataOffset; // IN vertexData, SAU -1 DACA VARFURILE SUNT DEJA IN BUFFER-UL STATIC
+		int slot; // POZITIA IN BUFFER-UL STATIC SAU IN CEL DINAMIC, STABILITA LA Flush (LA FUNDALURI, CEA PENTRU PRIMA CAMERA ACTIVA)
+		int background; // IN backgrounds, SAU -1 PENTRU UN SPRITE OBISNUIT
+	};
+
+	struct Background
+	{
+		double tileWidth;
+		double tileHeight;
+		double factorX;
+		double factorY;
+		double scrollBaseX;
+		double scrollBaseY;
+	};
+
+	std::vector<RenderItem> items;
+	std::vector<RenderItem> sortBuffer;
+
+	std::vector<float> vertexData;
+	std::vector<Background> backgrounds;
+
+	std::vector<int> activeCameras; // INDICII IN CameraManager, LA Flush-UL CURENT
+
+	// CE CONTINE BUFFER-UL STATIC: SPRITE-URILE IN ORDINEA DE DESENARE, CHEILE LOR SI O COPIE A VARFURILOR
+	std::vector<const Entity*> staticOwners;
+	std::vector<unsigned long long> staticKeys;
+	std::vector<float> staticData;
+	std::unordered_map<const Entity*, int> staticSlots;
+
+	std::vector<const Entity*> newStaticOwners;
+	std::vector<unsigned long long> newStaticKeys;
+	std::vector<float> newStaticData;
+
+	std::vector<float> dynamicData;
+
+	RenderBackend* bufferBackend = nullptr; // BACKEND-UL (FARA CACHE) CARE A CREAT BUFFERELE DE MAI JOS
+
+	bool usesBlending = false;
+
+	unsigned int staticVAOID = 0;
+	unsigned int staticVBOID = 0;
+	unsigned int dynamicVAOID = 0;
+	unsigned int dynamicVBOID = 0;
+
+	std::vector<RenderCommand> commands;
+
+	long long flushCount = 0;
+	int lastFlushSpriteCount = 0;
+	long long lastFlushUploadedBytes = 0;
+
+	// DACA SPRITE-URILE STATICE SUNT ACELEASI, IN ACEEASI ORDINE, CA LA Flush-UL TRECUT, SUNT RESCRISE DOAR CELE CARE AU VENIT CU VARFURI NOI.
+	// ALTFEL BUFFER-UL E RECONSTRUIT IN NOUA ORDINE, CU VARFURILE NESCHIMBATE LUATE DIN COPIA VECHE
+	void UpdateStaticBuffer(RenderBackend* backend, bool executes)
+	{
+		this->newStaticOwners.clear();
+		this->newStaticKeys.clear();
+
+		for (int i = 0; i < this->items.size(); i++)
+		{
+			if (this->items[i].isStatic)
+			{
+				this->items[i].slot = (int)this->newStaticOwners.size();
+
+				this->newStaticOwners.push_back(this->items[i].owner);
+				this->newStaticKeys.push_back(this->items[i].key);
+			}
+		}
+
+		if (this->newStaticOwners == this->staticOwners && this->newStaticKeys == this->staticKeys)
+		{
+			int uploadedSprites = 0;
+
+			if (executes)
+			{
+				backend->BindBuffer(this->staticVBOID);
+			}
+
+			for (int i = 0; i < this->items.size(); i++)
+			{
+				const RenderItem& item = this->items[i];
+
+				if (item.isStatic && item.dataOffset != -1)
+				{
+					std::memcpy(this->staticData.data() + item.slot * RenderQueue::VERTEX_DATA_SIZE, this->vertexData.data() + item.dataOffset, sizeof(float) * RenderQueue::VERTEX_DATA_SIZE);
+
+					if (executes)
+					{
+						backend->BufferSubData(sizeof(float) * item.slot * RenderQueue::VERTEX_DATA_SIZE, this->vertexData.data() + item.dataOffset, sizeof(float) * RenderQueue::VERTEX_DATA_SIZE);
+					}
+
+					uploadedSprites++;
+				}
+			}
+
+			if (uploadedSprites > 0)
+			{
+				this->commands.push_back({ RenderCommandType::UPLOAD_STATIC, (unsigned int)uploadedSprites, 0 });
+				this->lastFlushUploadedBytes += (long long)sizeof(float) * uploadedSprites * RenderQueue::VERTEX_DATA_SIZE;
+			}
+
+			return;
+		}
+
+		this->newStaticData.resize(this->newStaticOwners.size() * RenderQueue::VERTEX_DATA_SIZE);
+
+		for (int i = 0; i < this->items.size(); i++)
+		{
+			const RenderItem& item = this->items[i];
+
+			if (!item.isStatic)
+			{
+				continue;
+			}
+
+			const float* data = nullptr;
+
+			if (item.dataOffset != -1)
+			{
+				data = this->vertexData.data() + item.dataOffset;
+			}
+			else
+			{
+				auto oldSlot = this->staticSlots.find(item.owner);
+
+				if (oldSlot == this->staticSlots.end())
+				{
+					std::cout << "ERROR :: RENDER QUEUE :: FLUSH :: A STATIC SPRITE WITHOUT VERTEX DATA WAS NOT IN THE STATIC BUFFER\n";
+
+					continue;
+				}
+
+				data = this->staticData.data() + oldSlot->second * RenderQueue::VERTEX_DATA_SIZE;
+			}
+
+			std::memcpy(this->newStaticData.data() + item.slot * RenderQueue::VERTEX_DATA_SIZE, data, sizeof(float) * RenderQueue::VERTEX_DATA_SIZE);
+		}
+
+		this->staticOwners.swap(this->newStaticOwners);
+		this->staticKeys.swap(this->newStaticKeys);
+		this->staticData.swap(this->newStaticData);
+
+		this->staticSlots.clear();
+		for (int i = 0; i < this->staticOwners.size(); i++)
+		{
+			this->staticSlots[this->staticOwners[i]] = i;
+		}
+
+		if (executes)
+		{
+			backend->BindBuffer(this->staticVBOID);
+			backend->BufferData(this->staticData.data(), sizeof(float) * this->staticData.size(), BufferUsage::STATIC);
+		}
+
+		this->commands.push_back({ RenderCommandType::UPLOAD_STATIC, (unsigned int)this->staticOwners.size(), 0 });
+		this->lastFlushUploadedBytes += (long long)sizeof(float) * this->staticData.size();
+	}
+
+	void UpdateDynamicBuffer(RenderBackend* backend, bool executes)
+	{
+		this->dynamicData.clear();
+
+		for (int i = 0; i < this->items.size(); i++)
+		{
+			RenderItem& item = this->items[i];
+
+			if (!item.isStatic && item.background == -1)
+			{
+				item.slot = (int)(this->dynamicData.size() / RenderQueue::VERTEX_DATA_SIZE);
+
+				const float* data = this->vertexData.data() + item.dataOffset;
+				this->dynamicData.insert(this->dynamicData.end(), data, data + RenderQueue::VERTEX_DATA_SIZE);
+			}
+		}
+
+		// DUPA SPRITE-URI, DREPTUNGHIURILE FUNDALURILOR, GRUPATE PE CAMERE
+		int backgroundBase = (int)(this->dynamicData.size() / RenderQueue::VERTEX_DATA_SIZE);
+
+		for (int i = 0; i < this->items.size(); i++)
+		{
+			if (this->items[i].background != -1)
+			{
+				this->items[i].slot = backgroundBase + this->items[i].background;
+			}
+		}
+
+		for (int cameraIndex = 0; cameraIndex < this->activeCameras.size(); cameraIndex++)
+		{
+			double left, bottom, right, top;
+			CameraManager::Get()->GetCamera(this->activeCameras[cameraIndex])->GetVisibleArea(left, bottom, right, top);
+
+			for (int i = 0; i < this->backgrounds.size(); i++)
+			{
+				this->AppendBackground(this->backgrounds[i], left, bottom, right, top);
+			}
+		}
+
+		if (this->dynamicData.empty())
+		{
+			return;
+		}
+
+		if (executes)
+		{
+			backend->BindBuffer(this->dynamicVBOID);
+			backend->BufferData(this->dynamicData.data(), sizeof(float) * this->dynamicData.size(), BufferUsage::STREAM);
+		}
+
+		this->commands.push_back({ RenderCommandType::UPLOAD_DYNAMIC, (unsigned int)(this->dynamicData.size() / RenderQueue::VERTEX_DATA_SIZE), 0 });
+		this->lastFlushUploadedBytes += (long long)sizeof(float) * this->dynamicData.size();
+	}
+
+	// UN DREPTUNGHI PE TOATA ZONA VIZIBILA, CU TEXTURA DERULATA
+	void AppendBackground(const Background& background, double left, double bottom, double right, double top)
+	{
+		double scrollX = left * background.factorX + background.scrollBaseX;
+		double scrollY = bottom * background.factorY + background.scrollBaseY;
+
+		// COORDONATELE DE TEXTURA SUNT READUSE IN [0, 1), CA PRECIZIA float SA NU SCADA DEPARTE DE ORIGINE (TEXTURA SE REPETA ORICUM)
+		double leftU = scrollX / background.tileWidth;
+		leftU -= std::floor(leftU);
+		double rightU = leftU + (right - left) / background.tileWidth;
+
+		// TEXTURILE AU ORIGINEA IN COLTUL DE SUS, DECI v SCADE IN SUS
+		double bottomV = -scrollY / background.tileHeight;
+		bottomV -= std::floor(bottomV);
+		double topV = bottomV - (top - bottom) / background.tileHeight;
+
+		float data[RenderQueue::VERTEX_DATA_SIZE] =
+		{
+			(float)left, (float)bottom, (float)leftU, (float)bottomV,
+			(float)right, (float)bottom, (float)rightU, (float)bottomV,
+			(float)right, (float)top, (float)rightU, (float)topV,
+			(float)right, (float)top, (float)rightU, (float)topV,
+			(float)left, (float)bottom, (float)leftU, (float)bottomV,
+			(float)left, (float)top, (float)leftU, (float)topV,
+		};
+
+		this->dynamicData.insert(this->dynamicData.end(), data, data + RenderQueue::VERTEX_DATA_SIZE);
+	}
+
+	// RADIX SORT LSD PE OCTETI, STABIL. HISTOGRAMELE CELOR 8 TRECERI SE FAC DINTR-O SINGURA PARCURGERE,
+	// IAR TRECERILE IN CARE TOATE CHEILE AU ACELASI OCTET (DE EXEMPLU, UN SINGUR STRAT) SUNT SARITE
+	void SortItems()
+	{
+		int itemCount = (int)this->items.size();
+
+		if (itemCount < 2)
+		{
+			return;
+		}
+
+		static const int PASSES = 8;
+
+		std::array<std::array<int, 256>, PASSES> counts = {};
+
+		for (int i = 0; i < itemCount; i++)
+		{
+			unsigned long long key = this->items[i].key;
+
+			for (int pass = 0; pass < PASSES; pass++)
+			{
+				counts[pass][(key >> (pass * 8)) & 0xFF]++;
+			}
+		}
+
+		this->sortBuffer.resize(itemCount);
+
+		for (int pass = 0; pass < PASSES; pass++)
+		{
+			if (counts[pass][(this->items[0].key >> (pass * 8)) & 0xFF] == itemCount)
+			{
+				continue;
+			}
+
+			int offset = 0;
+			for (int digit = 0; digit < 256; digit++)
+			{
+				int count = counts[pass][digit];
+				counts[pass][digit] = offset;
+				offset += count;
+			}
+
+			for (int i = 0; i < itemCount; i++)
+			{
+				this->sortBuffer[counts[pass][(this->items[i].key >> (pass * 8)) & 0xFF]++] = this->items[i];
+			}
+
+			this->items.swap(this->sortBuffer);
+		}
+	}
+
+	RenderQueue() {};
+
+	RenderQueue(const RenderQueue&) = delete;
+};
+
+// CLASA TIMING WHEEL
+
+// UN EVENIMENT PROGRAMAT IN TIMING WHEEL. DACA entity DEVINE nullptr, EVENIMENTUL E ANULAT SI NODUL SE RECICLEAZA CAND II VINE RANDUL
+struct TimingWheelNode
+{
+	Entity* entity = nullptr;
+
+	long long tick = 0;
+
+	TimingWheelNode* next = nullptr;
+};
+
+// TIMING WHEEL IERARHIC (4 NIVELE X 64 SLOTURI, UN TICK = 1 MILISECUNDA)
+// PROGRAMAREA SI ANULAREA SUNT O(1), IAR UN AVANS COSTA CAT NUMARUL DE TICK-URI TRECUTE PLUS NUMARUL DE EVENIMENTE DECLANSATE
+class TimingWheel
+{
+public:
+
+	static const int LEVELS = 4;
+	static const int SLOT_BITS = 6;
+	static const int SLOTS = 1 << SLOT_BITS;
+	static const long long TICKS_PER_SECOND = 1000;
+
+	TimingWheel()
+	{
+		for (int i = 0; i < TimingWheel::LEVELS; i++)
+		{
+			for (int j = 0; j < TimingWheel::SLOTS; j++)
+			{
+				this->slots[i][j] = nullptr;
+			}
+		}
+	}
+
+	~TimingWheel()
+	{
+		for (int i = 0; i < TimingWheel::LEVELS; i++)
+		{
+			for (int j = 0; j < TimingWheel::SLOTS; j++)
+			{
+				this->DeleteList(this->slots[i][j]);
+			}
+		}
+
+		for (int i = 0; i < this->freeNodes.size(); i++)
+		{
+			delete this->freeNodes[i];
+		}
+	}
+
+	static long long TimeToTick(double time)
+	{
+		return (long long)(time * TimingWheel::TICKS_PER_SECOND + 0.5);
+	}
+
+	// Advance TREBUIE APELAT CU TIMPUL CURENT INAINTE DE A PROGRAMA CEVA, CA ROATA SA NU RAMANA IN URMA
+	TimingWheelNode* Schedule(Entity* entity, double time)
+	{
+		TimingWheelNode* node;
+
+		if (this->freeNodes.empty())
+		{
+			node = new TimingWheelNode();
+		}
+		else
+		{
+			node = this->freeNodes.back();
+			this->freeNodes.pop_back();
+		}
+
+		node->entity = entity;
+		node->tick = TimingWheel::TimeToTick(time);
+
+		this->Insert(node);
+		this->scheduledCount++;
+
+		return node;
+	}
+
+	static void Cancel(TimingWheelNode* node)
+	{
+		if (node != nullptr)
+		{
+			node->entity = nullptr;
+		}
+	}
+
+	// AVANSEAZA PANA LA time SI PUNE IN fired ENTITATILE ALE CAROR EVENIMENTE AU EXPIRAT (CELE ANULATE SUNT DOAR RECICLATE)
+	void Advance(double time, std::vector<Entity*>& fired)
+	{
+		long long targetTick = TimingWheel::TimeToTick(time);
+
+		if (targetTick < this->currentTick)
+		{
+			// TIMPUL A FOST DAT INAPOI (DE EXEMPLU LA PORNIREA UNUI REPLAY). TOT CE E PROGRAMAT SE DECLANSEAZA ACUM
+			for (int i = 0; i < TimingWheel::LEVELS; i++)
+			{
+				for (int j = 0; j < TimingWheel::SLOTS; j++)
+				{
+					this->Fire(this->slots[i][j], fired);
+					this->slots[i][j] = nullptr;
+				}
+			}
+
+			this->currentTick = targetTick;
+
+			return;
+		}
+
+		while (this->currentTick < targetTick)
+		{
+			if (this->scheduledCount == 0)
+			{
+				this->currentTick = targetTick;
+
+				break;
+			}
+
+			this->currentTick++;
+
+			// CAND NIVELUL DE JOS FACE O ROTATIE COMPLETA, COBORAM SLOTUL CORESPUNZATOR DE PE NIVELELE DE SUS
+			for (int level = 1; level < TimingWheel::LEVELS; level++)
+			{
+				if ((this->currentTick & ((1LL << (TimingWheel::SLOT_BITS * level)) - 1)) != 0)
+				{
+					break;
+				}
+
+				int slot = (int)((this->currentTick >> (TimingWheel::SLOT_BITS * level)) & (TimingWheel::SLOTS - 1));
+
+				TimingWheelNode* node = this->slots[level][slot];
+				this->slots[level][slot] = nullptr;
+
+				while (node != nullptr)
+				{
+					TimingWheelNode* next = node->next;
+
+					this->Insert(node);
+
+					node = next;
+				}
+			}
+
+			int slot = (int)(this->currentTick & (TimingWheel::SLOTS - 1));
+
+			this->Fire(this->slots[0][slot], fired);
+			this->slots[0][slot] = nullptr;
+		}
+	}
+
+	int GetScheduledCount()
+	{
+		return this->scheduledCount;
+	}
+
+private:
+
+	TimingWheelNode* slots[TimingWheel::LEVELS][TimingWheel::SLOTS];
+
+	std::vector<TimingWheelNode*> freeNodes;
+
+	long long currentTick = 0;
+	int scheduledCount = 0;
+
+	void Insert(TimingWheelNode* node)
+	{
+		long long delta = std::max(node->tick - this->currentTick, 1LL);
+
+		int level = 0;
+		while (level < TimingWheel::LEVELS - 1 && delta >= (1LL << (TimingWheel::SLOT_BITS * (level + 1))))
+		{
+			level++;
+		}
+
+		// MAI DEPARTE DE CAT ACOPERA ROATA NU ARE SENS PENTRU ANIMATII. SE LIMITEAZA LA ULTIMUL SLOT POSIBIL
+		if (delta >= (1LL << (TimingWheel::SLOT_BITS * TimingWheel::LEVELS)))
+		{
+			node->tick = this->currentTick + (1LL << (TimingWheel::SLOT_BITS * TimingWheel::LEVELS)) - 1;
+		}
+		else if (node->tick <= this->currentTick)
+		{
+			node->tick = this->currentTick + 1;
+		}
+
+		int slot = (int)((node->tick >> (TimingWheel::SLOT_BITS * level)) & (TimingWheel::SLOTS - 1));
+
+		node->next = this->slots[level][slot];
+		this->slots[level][slot] = node;
+	}
+
+	void Fire(TimingWheelNode* node, std::vector<Entity*>& fired)
+	{
+		while (node != nullptr)
+		{
+			TimingWheelNode* next = node->next;
+
+			if (node->entity != nullptr)
+			{
+				fired.push_back(node->entity);
+			}
+
+			node->entity = nullptr;
+			node->next = nullptr;
+			this->freeNodes.push_back(node);
+			this->scheduledCount--;
+
+			node = next;
+		}
+	}
+
+	void DeleteList(TimingWheelNode* node)
+	{
+		while (node != nullptr)
+		{
+			TimingWheelNode* next = node->next;
+
+			delete node;
+
+			node = next;
+		}
+	}
+
+	TimingWheel(const TimingWheel&) = delete;
+};
+
+// POINTER CATRE UN EVENIMENT PROGRAMAT INTR-UN TimingWheel. IL ANULEAZA LA DISTRUGERE SI SE GOLESTE LA MUTARE,
+// CA O COMPONENTA CARE IL CONTINE SA POATA FI MUTATA IN STOCAREA COMPONENTELOR FARA SA PIARDA SAU SA DUBLEZE EVENIMENTUL
+class TimingWheelHandle
+{
+public:
+
+	TimingWheelHandle() {};
+
+	TimingWheelHandle(TimingWheelHandle&& other) noexcept : node(other.node)
+	{
+		other.node = nullptr;
+	}
+
+	TimingWheelHandle& operator=(TimingWheelHandle&& other) noexcept
+	{
+		if (this != &other)
+		{
+			TimingWheel::Cancel(this->node);
+
+			this->node = other.node;
+			other.node = nullptr;
+		}
+
+		return *this;
+	}
+
+	// DOAR INLOCUIESTE NODUL (CEL VECHI TREBUIE ANULAT EXPLICIT DACA E CAZUL, SAU A FOST DEJA DECLANSAT)
+	TimingWheelHandle& operator=(TimingWheelNode* node)
+	{
+		this->node = node;
+
+		return *this;
+	}
+
+	~TimingWheelHandle()
+	{
+		TimingWheel::Cancel(this->node);
+	}
+
+	operator TimingWheelNode* () const
+	{
+		return this->node;
+	}
+
+private:
+
+	TimingWheelNode* node = nullptr;
+
+	TimingWheelHandle(const TimingWheelHandle&) = delete;
+};
+
+// CLASA COMPONENT STORAGE
+
+// CE TREBUIE STIUT DESPRE UN TIP DE COMPONENTA CA SA FIE MUTAT SI DISTRUS FARA SA I SE CUNOASCA TIPUL. SE COMPLETEAZA O SINGURA DATA PE TIP
+struct ComponentTypeInfo
+{
+	int size = 0;
+	int alignment = 0;
+
+	bool isTriviallyCopyable = false; // MUTARILE SE FAC CU memcpy SI NU E NEVOIE DE DESTRUCTOR
+
+	void (*relocate)(void* destination, void* source) = nullptr; // CONSTRUIESTE IN destination DIN source SI IL DISTRUGE PE source
+	void (*destroy)(void* component) = nullptr;
+};
+
+template<typename T>
+struct ComponentTypeFunctions
+{
+	static void Relocate(void* destination, void* source)
+	{
+		new (destination) T(std::move(*static_cast<T*>(source)));
+
+		static_cast<T*>(source)->~T();
+	}
+
+	static void Destroy(void* component)
+	{
+		static_cast<T*>(component)->~T();
+	}
+};
+
+// COMPONENTELE CARE AU NEVOIE DE ENTITATEA LOR DECLARA UN MEMBRU Entity* entity, COMPLETAT LA ADAUGARE
+template<typename T, typename = void>
+struct HasOwnerEntity : std::false_type {};
+
+template<typename T>
+struct HasOwnerEntity<T, std::void_t<decltype(std::declval<T&>().entity)>> : std::true_type {};
+
+// TOATE COMPONENTELE DE UN ANUMIT TIP, UNA LANGA ALTA, IN BLOCURI DE CATE CHUNK_SIZE. ADAUGAREA NU MUTA COMPONENTELE EXISTENTE,
+// IAR LA STERGERE ULTIMA COMPONENTA E MUTATA IN LOCUL CELEI STERSE, CA BLOCURILE SA RAMANA COMPACTE
+class ComponentStorage
+{
+public:
+
+	static constexpr int CHUNK_SHIFT = 7;
+	static constexpr int CHUNK_SIZE = 1 << CHUNK_SHIFT;
+
+	ComponentStorage() {};
+
+	// COMPONENTELE RAMASE (ALE ENTITATILOR NESTERSE) SUNT DISTRUSE ODATA CU LUMEA
+	~ComponentStorage()
+	{
+		if (!this->typeInfo.isTriviallyCopyable)
+		{
+			for (int i = 0; i < this->count; i++)
+			{
+				this->typeInfo.destroy(this->Get(i));
+			}
+		}
+
+		for (int i = 0; i < this->chunks.size() && this->arena == nullptr; i++)
+		{
+			::operator delete(this->chunks[i], std::align_val_t(this->typeInfo.alignment));
+		}
+
+		if (this->swapBuffer != nullptr)
+		{
+			::operator delete(this->swapBuffer, std::align_val_t(this->typeInfo.alignment));
+		}
+	}
+
+	void Initialize(const ComponentTypeInfo& typeInfo, MemoryArena* arena)
+	{
+		this->typeInfo = typeInfo;
+		this->arena = arena;
+
+		this->isInitialized = true;
+	}
+
+	bool IsInitialized()
+	{
+		return this->isInitialized;
+	}
+
+	void* Get(int index)
+	{
+		return this->chunks[index >> ComponentStorage::CHUNK_SHIFT] + (index & (ComponentStorage::CHUNK_SIZE - 1)) * this->typeInfo.size;
+	}
+
+	template<typename T>
+	T* Get(int index)
+	{
+		return reinterpret_cast<T*>(this->chunks[index >> ComponentStorage::CHUNK_SHIFT]) + (index & (ComponentStorage::CHUNK_SIZE - 1));
+	}
+
+	// REZERVA UN LOC LA SFARSIT PENTRU COMPONENTA LUI owner. APELANTUL CONSTRUIESTE COMPONENTA LA ADRESA LOCULUI INTORS
+	int Allocate(Entity* owner)
+	{
+		if (this->count == this->chunks.size() * ComponentStorage::CHUNK_SIZE)
+		{
+			if (this->arena != nullptr)
+			{
+				this->chunks.push_back((unsigned char*)this->arena->Allocate((std::size_t)this->typeInfo.size * ComponentStorage::CHUNK_SIZE, this->typeInfo.alignment));
+			}
+			else
+			{
+				this->chunks.push_back((unsigned char*)::operator new((std::size_t)this->typeInfo.size * ComponentStorage::CHUNK_SIZE, std::align_val_t(this->typeInfo.alignment)));
+			}
+		}
+
+		this->owners.push_back(owner);
+		this->version++;
+
+		return this->count++;
+	}
+
+	// DISTRUGE COMPONENTA DE LA index SI MUTA ULTIMA COMPONENTA IN LOCUL EI. INTOARCE ENTITATEA CAREI I S-A MUTAT COMPONENTA (SAU nullptr)
+	Entity* Remove(int index)
+	{
+		if (!this->typeInfo.isTriviallyCopyable)
+		{
+			this->typeInfo.destroy(this->Get(index));
+		}
+
+		int last = this->count - 1;
+
+		Entity* movedOwner = nullptr;
+
+		if (index != last)
+		{
+			this->Move(this->Get(index), this->Get(last));
+
+			this->owners[index] = this->owners[last];
+			movedOwner = this->owners[index];
+		}
+
+		this->owners.pop_back();
+		this->count--;
+		this->version++;
+
+		return movedOwner;
+	}
+
+	// RESCRIE STOCAREA IN ORDINEA DATA: PE POZITIA i AJUNGE COMPONENTA CARE ERA PE order[i]. FIECARE COMPONENTA E MUTATA O SINGURA DATA
+	// (PE CICLURILE PERMUTARII, CU UN SINGUR LOC LIBER). APELANTUL ACTUALIZEAZA INDICII DIN ENTITATI, DUPA GetOwner
+	void Reorder(const int* order, int count)
+	{
+		if (count != this->count)
+		{
+			std::cout << "ERROR :: COMPONENT STORAGE :: REORDER :: THE ORDER DOES NOT CONTAIN EVERY COMPONENT\n";
+
+			return;
+		}
+
+		if (this->swapBuffer == nullptr)
+		{
+			this->swapBuffer = (unsigned char*)::operator new((std::size_t)this->typeInfo.size, std::align_val_t(this->typeInfo.alignment));
+		}
+
+		FrameAllocatorScope scratch;
+
+		FrameVector<bool> isPlaced(this->count, false);
+
+		for (int start = 0; start < this->count; start++)
+		{
+			if (isPlaced[start] || order[start] == start)
+			{
+				continue;
+			}
+
+			this->Move(this->swapBuffer, this->Get(start));
+
+			int current = start;
+
+			while (order[current] != start)
+			{
+				this->Move(this->Get(current), this->Get(order[current]));
+				isPlaced[current] = true;
+
+				current = order[current];
+			}
+
+			this->Move(this->Get(current), this->swapBuffer);
+			isPlaced[current] = true;
+		}
+
+		this->reorderedOwners.resize(this->count);
+		for (int i = 0; i < this->count; i++)
+		{
+			this->reorderedOwners[i] = this->owners[order[i]];
+		}
+		this->owners.swap(this->reorderedOwners);
+
+		this->version++;
+	}
+
+	// DISTRUGE TOATE COMPONENTELE. BLOCURILE RAMAN, PENTRU COMPONENTELE URMATOARE. INDICII DIN ENTITATI NU SUNT ATINSI (VEZI EntityManager::DeleteAllEntities)
+	void Clear()
+	{
+		if (!this->typeInfo.isTriviallyCopyable)
+		{
+			for (int i = 0; i < this->count; i++)
+			{
+				this->typeInfo.destroy(this->Get(i));
+			}
+		}
+
+		this->owners.clear();
+		this->count = 0;
+		this->version++;
+	}
+
+	// INTOARCE SISTEMULUI BLOCURILE GOALE DE LA SFARSIT (NU SI PE CELE DIN ARENA, CARE SE ELIBEREAZA ODATA CU EA)
+	void ReleaseUnusedChunks()
+	{
+		if (this->arena != nullptr)
+		{
+			return;
+		}
+
+		int usedChunks = (this->count + ComponentStorage::CHUNK_SIZE - 1) >> ComponentStorage::CHUNK_SHIFT;
+
+		for (int i = usedChunks; i < this->chunks.size(); i++)
+		{
+			::operator delete(this->chunks[i], std::align_val_t(this->typeInfo.alignment));
+		}
+
+		this->chunks.resize(usedChunks);
+	}
+
+	int GetCount()
+	{
+		return this->count;
+	}
+
+	// CATE COMPONENTE INCAP IN BLOCURILE ALOCATE
+	int GetCapacity()
+	{
+		return (int)this->chunks.size() * ComponentStorage::CHUNK_SIZE;
+	}
+
+	// CRESTE LA FIECARE ADAUGARE, STERGERE SI REORDONARE (O CAPTURA A COMPONENTELOR E VALIDA CAT TIMP NU SE SCHIMBA)
+	std::uint64_t GetVersion()
+	{
+		return this->version;
+	}
+
+	Entity* GetOwner(int index)
+	{
+		return this->owners[index];
+	}
+
+	int GetChunkCount()
+	{
+		return (int)this->chunks.size();
+	}
+
+	// BLOCURILE SUNT CONTINUE, DECI COMPONENTELE TRIVIAL COPIABILE POT FI SALVATE SAU RESTAURATE CU memcpy PE BLOCURI INTREGI
+	unsigned char* GetChunk(int chunk)
+	{
+		return this->chunks[chunk];
+	}
+
+	const ComponentTypeInfo& GetTypeInfo()
+	{
+		return this->typeInfo;
+	}
+
+private:
+
+	ComponentTypeInfo typeInfo;
+	bool isInitialized = false;
+
+	MemoryArena* arena = nullptr; // BLOCURILE VIN DIN ARENA LUMII, DACA ARE UNA
+
+	std::vector<unsigned char*> chunks;
+	std::vector<Entity*> owners;
+
+	int count = 0;
+	std::uint64_t version = 0;
+
+	// PENTRU Reorder
+	unsigned char* swapBuffer = nullptr;
+	std::vector<Entity*> reorderedOwners;
+
+	void Move(void* destination, void* source)
+	{
+		if (this->typeInfo.isTriviallyCopyable)
+		{
+			std::memcpy(destination, source, this->typeInfo.size);
+		}
+		else
+		{
+			this->typeInfo.relocate(destination, source);
+		}
+	}
+
+	ComponentStorage(const ComponentStorage&) = delete;
+};
+
+// CLASA COMPONENT STORAGE MANAGER
+
+// CATE O STOCARE PENTRU FIECARE ID DE COMPONENTA
+class ComponentStorageManager
+{
+public:
+
+	static ComponentStorageManager* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->componentStorageManager == nullptr)
+		{
+			world->componentStorageManager = new ComponentStorageManager();
+		}
+
+		return world->componentStorageManager;
+	}
+
+	// INREGISTREAZA TIPUL LA PRIMA FOLOSIRE
+	template<typename T>
+	ComponentStorage& GetStorage()
+	{
+		ComponentStorage& storage = this->storages[GetComponentTypeID<T>()];
+
+		if (!storage.IsInitialized())
+		{
+			ComponentTypeInfo typeInfo;
+			typeInfo.size = sizeof(T);
+			typeInfo.alignment = alignof(T);
+			typeInfo.isTriviallyCopyable = std::is_trivially_copyable<T>::value;
+			typeInfo.relocate = &ComponentTypeFunctions<T>::Relocate;
+			typeInfo.destroy = &ComponentTypeFunctions<T>::Destroy;
+
+			storage.Initialize(typeInfo, World::GetCurrent()->GetArena());
+		}
+
+		return storage;
+	}
+
+	ComponentStorage& GetStorage(ComponentTypeID typeID)
+	{
+		return this->storages[typeID];
+	}
+
+	// COMPONENTELE EXISTENTE SI MEMORIA BLOCURILOR, PENTRU TOATE TIPURILE
+	void GetMemoryUsage(int& liveComponents, std::size_t& usedBytes, std::size_t& reservedBytes)
+	{
+		liveComponents = 0;
+		usedBytes = 0;
+		reservedBytes = 0;
+
+		for (int i = 0; i < MAX_COMPONENTS; i++)
+		{
+			if (!this->storages[i].IsInitialized())
+			{
+				continue;
+			}
+
+			liveComponents += this->storages[i].GetCount();
+			usedBytes += (std::size_t)this->storages[i].GetCount() * this->storages[i].GetTypeInfo().size;
+			reservedBytes += (std::size_t)this->storages[i].GetCapacity() * this->storages[i].GetTypeInfo().size;
+		}
+	}
+
+	void ClearStorages()
+	{
+		for (int i = 0; i < MAX_COMPONENTS; i++)
+		{
+			if (this->storages[i].IsInitialized())
+			{
+				this->storages[i].Clear();
+			}
+		}
+	}
+
+	void ReleaseUnusedChunks()
+	{
+		for (int i = 0; i < MAX_COMPONENTS; i++)
+		{
+			this->storages[i].ReleaseUnusedChunks();
+		}
+	}
+
+private:
+
+	ComponentStorage storages[MAX_COMPONENTS];
+
+	ComponentStorageManager() {};
+
+	ComponentStorageManager(const ComponentStorageManager&) = delete;
+};
+
+// CLASA ENTITY
+
+class Entity
+{
+public:
+
+	Entity(EntityType entityType, bool isAnimated, bool isArtificialIntelligence) : entityType(entityType), isAnimated(isAnimated), isArtificialIntelligence(isArtificialIntelligence)
+	{
+		for (int i = 0; i < MAX_COMPONENTS; i++)
+		{
+			this->componentBitset[i] = false;
+			this->componentIndices[i] = -1;
+		}
+
+		if (this->entityType == EntityType::character)
+		{
+			EntityManager::Get()->AddCharacter(this);
+		}
+		else if (this->entityType == EntityType::terrain)
+		{
+			EntityManager::Get()->AddTerrain(this);
+		}
+		else if (this->entityType == EntityType::bullet)
+		{
+			EntityManager::Get()->AddBullet(this);
+		}
+		else if (this->entityType == EntityType::landScape)
+		{
+			EntityManager::Get()->AddLandScape(this);
+		}
+
+		if (this->isAnimated)
+		{
+			EntityManager::Get()->AddAnimatedEntity(this);
+		}
+
+		if (this->isArtificialIntelligence)
+		{
+			EntityManager::Get()->AddArtificialIntelligence(this);
+		}
+
+		EntityManager::Get()->AddToLevel(this);
+	}
+
+	virtual ~Entity()
+	{
+		// EntityManager::DeleteAllEntities GOLESTE LISTELE SI STOCARILE DEODATA, DUPA CE STERGE TOATE ENTITATILE
+		if (EntityManager::Get()->IsDeletingAllEntities())
+		{
+			return;
+		}
+
+		EntityManager::Get()->RemoveFromLevel(this);
+
+		for (int i = 0; i < MAX_COMPONENTS; i++)
+		{
+			if (this->componentBitset[i])
+			{
+				this->RemoveComponent(i);
+			}
+		}
+
+		// UnloadLevel A SCOS DEJA DIN LISTE TOATE ENTITATILE NIVELULUI
+		if (this->level != 0 && this->level == EntityManager::Get()->GetUnloadingLevel())
+		{
+			return;
+		}
+
+		if (entityType == EntityType::character)
+		{
+			EntityManager::Get()->RemoveCharacter(this);
+		}
+		else if (entityType == EntityType::terrain)
+		{
+			EntityManager::Get()->RemoveTerrain(this);
+		}
+		else if (entityType == EntityType::bullet)
+		{
+			EntityManager::Get()->RemoveBullet(this);
+		}
+		else if (entityType == EntityType::landScape)
+		{
+			EntityManager::Get()->RemoveLandScape(this);
+		}
+
+		if (this->isAnimated)
+		{
+			EntityManager::Get()->RemoveAnimatedEntity(this);
+		}
+
+		if (this->isArtificialIntelligence)
+		{
+			EntityManager::Get()->RemoveArtificialIntelligence(this);
+		}
+	}
+
+	// ENTITATILE (SI CELE DERIVATE) SUNT ALOCATE DIN EntityPool-UL LUMII CURENTE. MEMORIA SE INTOARCE IN POOL-UL DIN CARE A FOST LUATA,
+	// DAR DESTRUCTORUL LUCREAZA CU LISTELE LUMII CURENTE, DECI O ENTITATE TREBUIE STEARSA TOT IN LUMEA EI
+	static void* operator new(std::size_t size)
+	{
+		return EntityPool::Get()->Allocate(size);
+	}
+
+	static void operator delete(void* block, std::size_t size)
+	{
+		EntityPool::Free(block, size);
+	}
+
+	// COMPATIBILITATE CU AddComponent(new T(...)): COMPONENTA E MUTATA IN STOCAREA TIPULUI EI, IAR OBIECTUL DAT E STERS
+	template<typename T>
+	inline void AddComponent(T* component)
+	{
+		this->AddComponent<T>(std::move(*component));
+
+		delete component;
+	}
+
+	// CONSTRUIESTE COMPONENTA DIRECT IN STOCARE. O COMPONENTA DE ACELASI TIP CARE EXISTA DEJA E INLOCUITA
+	template<typename T, typename... Arguments>
+	inline T* AddComponent(Arguments&&... arguments)
+	{
+		if (this->componentBitset[GetComponentTypeID<T>()])
+		{
+			this->RemoveComponent(GetComponentTypeID<T>());
+		}
+
+		ComponentStorage& storage = ComponentStorageManager::Get()->GetStorage<T>();
+
+		int index = storage.Allocate(this);
+		T* component = new (storage.Get(index)) T(std::forward<Arguments>(arguments)...);
+
+		this->componentBitset[GetComponentTypeID<T>()] = true;
+		this->componentIndices[GetComponentTypeID<T>()] = index;
+
+		if constexpr (HasOwnerEntity<T>::value)
+		{
+			component->entity = this;
+		}
+
+		return component;
+	}
+
+	template<typename T>
+	inline void DeleteComponent()
+	{
+		if (this->componentBitset[GetComponentTypeID<T>()])
+		{
+			this->RemoveComponent(GetComponentTypeID<T>());
+		}
+		else
+		{
+			std::cout << "WARNING :: ENTITY :: DELETECOMPONENT :: COULD NOT DELETE A COMPONENT WHICH DID NOT EXIST IN THE FIRST PLACE\n";
+		}
+	}
+
+	// POINTERUL RAMANE VALID PANA LA STERGEREA UNEI COMPONENTE DE ACELASI TIP (ATUNCI ULTIMA COMPONENTA DIN STOCARE E MUTATA)
+	// SAU PANA LA O REORDONARE A STOCARII (VEZI SpatialOrderManager, LA SFARSITUL LUI GameEngine::UpdateSystems)
+	template<typename T>
+	inline T* GetComponent() const
+	{
+		if (!this->componentBitset[GetComponentTypeID<T>()])
+		{
+			std::cout << "WARNING :: ENTITY :: GETCOMPONENT :: UNCREATED COMPONENT WAS DEMANDED. RETURNING NULL POINTER...\n";
+
+			return nullptr;
+		}
+
+		return ComponentStorageManager::Get()->GetStorage(GetComponentTypeID<T>()).template Get<T>(this->componentIndices[GetComponentTypeID<T>()]);
+	}
+
+	// HasComponent<A, B, C>() E ADEVARAT DACA ENTITATEA LE ARE PE TOATE. PENTRU COMPONENTELE ENGINE-ULUI SE REDUCE LA UN SINGUR AND PE BITI
+	template<typename... Types>
+	inline bool HasComponent() const
+	{
+		if constexpr ((IsEngineComponent<Types>() && ...))
+		{
+			constexpr unsigned long long signature = GetComponentSignature<Types...>();
+
+			return (this->componentBitset.to_ullong() & signature) == signature;
+		}
+		else
+		{
+			const unsigned long long signature = GetComponentSignature<Types...>();
+
+			return (this->componentBitset.to_ullong() & signature) == signature;
+		}
+	}
+
+	ComponentBitset GetComponentBitset() const
+	{
+		return this->componentBitset;
+	}
+
+	EntityType GetEntityType()
+	{
+		return this->entityType;
+	}
+
+	// NIVELUL DIN CARE FACE PARTE (0 DACA A FOST CREATA IN AFARA UNUI NIVEL)
+	int GetLevel()
+	{
+		return this->level;
+	}
+
+private:
+
+	EntityType entityType;
+	bool isAnimated;
+	bool isArtificialIntelligence;
+
+	int level = 0;
+	int levelIndex = -1; // POZITIA IN LISTA NIVELULUI
+
+	friend class EntityManager; // TINE EVIDENTA NIVELELOR
+
+	ComponentBitset componentBitset;
+	ComponentIndexList componentIndices;
+
+	friend class SpatialOrderManager; // MUTA COMPONENTELE IN STOCARE SI LE ACTUALIZEAZA INDICII
+
+	void RemoveComponent(ComponentTypeID typeID)
+	{
+		Entity* movedOwner = ComponentStorageManager::Get()->GetStorage(typeID).Remove(this->componentIndices[typeID]);
+
+		if (movedOwner != nullptr)
+		{
+			movedOwner->componentIndices[typeID] = this->componentIndices[typeID];
+		}
+
+		this->componentBitset[typeID] = false;
+		this->componentIndices[typeID] = -1;
+	}
+};
+
+inline void EntityManager::AddToLevel(Entity* entity)
+{
+	entity->level = this->currentLevel;
+
+	if (this->currentLevel != 0)
+	{
+		std::vector<Entity*>& entities = this->levelEntities[this->currentLevel];
+
+		entity->levelIndex = (int)entities.size();
+		entities.push_back(entity);
+	}
+}
+
+inline void EntityManager::RemoveFromLevel(Entity* entity)
+{
+	if (entity->level == 0)
+	{
+		return;
+	}
+
+	std::vector<Entity*>& entities = this->levelEntities[entity->level];
+
+	entities[entity->levelIndex] = entities.back();
+	entities[entity->levelIndex]->levelIndex = entity->levelIndex;
+	entities.pop_back();
+
+	if (entities.empty())
+	{
+		this->levelEntities.erase(entity->level);
+	}
+
+	entity->levelIndex = -1;
+}
+
+inline void EntityManager::UnloadLevel(int level)
+{
+	if (level == 0)
+	{
+		std::cout << "ERROR :: ENTITY MANAGER :: UNLOADLEVEL :: THE ENTITIES CREATED OUTSIDE OF A LEVEL CANNOT BE UNLOADED\n";
+
+		return;
+	}
+
+	std::unordered_map<int, std::vector<Entity*>>::iterator it = this->levelEntities.find(level);
+
+	if (it == this->levelEntities.end())
+	{
+		return;
+	}
+
+	if (it->second.size() == this->characters.size() + this->terrains.size() + this->bullets.size() + this->landScapes.size())
+	{
+		this->DeleteAllEntities();
+
+		return;
+	}
+
+	// O COPIE, PENTRU CA FIECARE DESTRUCTOR SCOATE ENTITATEA DIN LISTA NIVELULUI
+	std::vector<Entity*> entities = it->second;
+
+	// O SINGURA TRECERE PRIN FIECARE LISTA, IN LOC DE O CAUTARE PENTRU FIECARE ENTITATE STEARSA (ORDINEA CELORLALTE SE PASTREAZA)
+	auto isInLevel = [level](Entity* entity)
+		{
+			return entity->GetLevel() == level;
+		};
+
+	this->RemoveFromListIf(this->characters, isInLevel);
+	this->RemoveFromListIf(this->terrains, isInLevel);
+	this->RemoveFromListIf(this->bullets, isInLevel);
+	this->RemoveFromListIf(this->landScapes, isInLevel);
+
+	this->RemoveFromListIf(this->animatedEntities, isInLevel);
+	this->RemoveFromListIf(this->animationStateChanges, isInLevel);
+
+	for (int i = 0; i < this->artificalIntelligence.size(); i++)
+	{
+		if (isInLevel(this->artificalIntelligence[i]))
+		{
+			this->artificialIntelligenceGrid.Remove(this->artificalIntelligence[i]);
+			this->behaviorGrid.Remove(this->artificalIntelligence[i]);
+		}
+	}
+
+	this->RemoveFromListIf(this->artificalIntelligence, isInLevel);
+	this->RemoveFromListIf(this->artificialIntelligenceToPlace, isInLevel);
+	this->RemoveFromListIf(this->activeArtificialIntelligence, isInLevel);
+	this->RemoveFromListIf(this->pendingArtificialIntelligence, isInLevel);
+	this->RemoveFromListIf(this->groundedBehaviors, isInLevel);
+	this->RemoveFromListIf(this->behaviorsToResume, isInLevel);
+
+	// CA LA DeleteAllEntities, NIMIC NU MAI TREBUIE SA ARATE SPRE ENTITATILE STERSE
+	if (Player::Get()->GetEntity() != nullptr && isInLevel(Player::Get()->GetEntity()))
+	{
+		Player::Get()->SetEntity(nullptr);
+	}
+
+	if (World::GetCurrent()->cameraManager != nullptr)
+	{
+		for (int i = 0; i < CameraManager::Get()->GetCameraCount(); i++)
+		{
+			Camera2D* camera = CameraManager::Get()->GetCamera(i);
+
+			if (camera->GetFollowedEntity() != nullptr && isInLevel(camera->GetFollowedEntity()))
+			{
+				camera->Follow(nullptr);
+			}
+		}
+	}
+
+	this->unloadingLevel = level;
+
+	for (int i = (int)entities.size() - 1; i >= 0; i--)
+	{
+		delete entities[i];
+	}
+
+	this->unloadingLevel = 0;
+}
+
+inline void EntityManager::DeleteAllEntities()
+{
+	std::vector<Entity*> entities;
+	entities.insert(entities.end(), this->characters.begin(), this->characters.end());
+	entities.insert(entities.end(), this->terrains.begin(), this->terrains.end());
+	entities.insert(entities.end(), this->bullets.begin(), this->bullets.end());
+	entities.insert(entities.end(), this->landScapes.begin(), this->landScapes.end());
+
+	this->isDeletingAllEntities = true;
+
+	for (int i = 0; i < entities.size(); i++)
+	{
+		delete entities[i];
+	}
+
+	this->isDeletingAllEntities = false;
+
+	// COMPONENTELE SUNT DISTRUSE DUPA ENTITATI, CA DESTRUCTORII CLASELOR DERIVATE SA LE MAI POATA FOLOSI
+	ComponentStorageManager::Get()->ClearStorages();
+
+	this->RemoveAllEntities();
+	this->levelEntities.clear();
+
+	Player::Get()->SetEntity(nullptr);
+
+	if (World::GetCurrent()->cameraManager != nullptr)
+	{
+		for (int i = 0; i < CameraManager::Get()->GetCameraCount(); i++)
+		{
+			CameraManager::Get()->GetCamera(i)->Follow(nullptr);
+		}
+	}
+}
+
+// CLASELE COMPONENTELOR. NU AU CLASA DE BAZA SI (CU EXCEPTIA CELOR CARE TIN EVENIMENTE PROGRAMATE) SUNT TRIVIAL COPIABILE
+// 2D
+class Position2D
+{
+public:
+
+	Position2D(Scalar x, Scalar y) : x(x), y(y) {};
+
+	Scalar x;
+	Scalar y;
+
+private:
+
+};
+
+class Hitbox2D
+{
+public:
+
+	Hitbox2D(Scalar width, Scalar height) : width(width), height(height)
+	{
+		this->collidedDownward = false;/////////////////////////////////////////////////////////////////////////////////
+	}
+
+	Scalar width;
+	Scalar height;
+
+	bool collidedDownward;////////////////////////////////////////////////////////////////////////////////////////////////
+
+private:
+
+};
+
+class Texture2D
+{
+public:
+
+	Texture2D() {};
+
+	unsigned int currentTextureID = 0;
+
+private:
+
+};
+
+class TextureBox2D
+{
+public:
+
+	TextureBox2D(Scalar width, Scalar height) : width(width), height(height) {};
+
+	Scalar width;
+	Scalar height;
+
+private:
+
+};
+
+class Render2D
+{
+public:
+
+	Render2D(int layer = 0, int depth = 0) : layer(layer), depth(depth) {};
+
+	// TRIMITE SPRITE-UL IN RenderQueue
+	void Render(Renderer2D* renderer2D)
+	{
+		if (!entity->HasComponent<Position2D>())
+		{
+			std::cout << "ERROR :: RENDER2DCOMPONENT :: THERE IS NO POSITION2D COMPONENT FOR ENTITY. RETURNING WITHOUT RENDERING...\n";
+
+			return;
+		}
+		if (!entity->HasComponent<TextureBox2D>())
+		{
+			std::cout << "ERROR :: RENDER2DCOMPONENT :: THERE IS NO TEXTUREBOX2D COMPONENT FOR ENTITY. RETURNING WITHOUT RENDERING...\n";
+
+			return;
+		}
+		if (!entity->HasComponent<Texture2D>())
+		{
+			std::cout << "ERROR :: RENDER2DCOMPONENT :: THERE IS NO TEXTURE2D COMPONENT FOR ENTITY. RETURNING WITHOUT RENDERING...\n";
+
+			return;
+		}
+
+		if (entity->GetComponent<Texture2D>()->currentTextureID == 0)
+		{
+			std::cout << "WARNING :: RENDER2DCOMPONENT :: THERE IS NO TEXTURE TO USE FOR RENDERING. SELECTING THE ERROR TEXTURE INSTEAD AND ATTEMPTING RENDERING...\n";
+
+			entity->GetComponent<Texture2D>()->currentTextureID = AssetManager::Get()->GetErrorTextureID();
+		}
+
+		Position2D* position = entity->GetComponent<Position2D>();
+		TextureBox2D* textureBox = entity->GetComponent<TextureBox2D>();
+		unsigned int textureID = entity->GetComponent<Texture2D>()->currentTextureID;
+
+		bool hasChanged = !this->hasVertexData || position->x != this->cachedX || position->y != this->cachedY
+			|| textureBox->width != this->cachedWidth || textureBox->height != this->cachedHeight || textureID != this->cachedTextureID;
+
+		if (hasChanged)
+		{
+			this->cachedX = position->x;
+			this->cachedY = position->y;
+			this->cachedWidth = textureBox->width;
+			this->cachedHeight = textureBox->height;
+			this->cachedTextureID = textureID;
+			this->hasVertexData = true;
+
+			this->ComputeVertexData();
+
+			this->unchangedSubmits = 0;
+			this->changedSubmits++;
+
+			if (this->changedSubmits >= Render2D::DYNAMIC_AFTER_SUBMITS)
+			{
+				this->isStatic = false;
+			}
+		}
+		else
+		{
+			this->changedSubmits = 0;
+			this->unchangedSubmits++;
+
+			if (this->unchangedSubmits >= Render2D::STATIC_AFTER_SUBMITS)
+			{
+				this->isStatic = true;
+			}
+		}
+
+		RenderQueue* renderQueue = RenderQueue::Get();
+
+		// TRIMIS DE DOUA ORI IN ACELASI CADRU: A DOUA OARA E DESENAT CA UN SPRITE DINAMIC
+		bool isSecondSubmit = this->lastSubmittedFlush == renderQueue->GetFlushCount();
+		bool isInStaticBuffer = this->wasSubmittedAsStatic && this->lastSubmittedFlush == renderQueue->GetFlushCount() - 1;
+
+		bool submitsAsStatic = this->isStatic && !isSecondSubmit;
+		bool needsVertexData = hasChanged || !submitsAsStatic || !isInStaticBuffer;
+
+		// DESENAT LA RenderQueue::Flush, IN ORDINEA STRATULUI, SHADER-ULUI SI TEXTURII
+		renderQueue->Submit(renderer2D, textureID, this->layer, this->depth, entity, submitsAsStatic, needsVertexData ? this->vertexData : nullptr);
+
+		if (!isSecondSubmit)
+		{
+			this->wasSubmittedAsStatic = submitsAsStatic;
+			this->lastSubmittedFlush = renderQueue->GetFlushCount();
+		}
+	}
+
+	// UN SPRITE DEVINE STATIC DUPA ATATEA TRIMITERI LA RAND IN CARE POZITIA, DIMENSIUNEA SI TEXTURA NU S-AU SCHIMBAT
+	// SI REDEVINE DINAMIC DUPA ATATEA TRIMITERI LA RAND IN CARE S-AU SCHIMBAT (O SCHIMBARE IZOLATA DOAR II RESCRIE VARFURILE)
+	static const int STATIC_AFTER_SUBMITS = 30;
+	static const int DYNAMIC_AFTER_SUBMITS = 2;
+
+	int layer; // INTRE RenderQueue::MIN_LAYER SI RenderQueue::MAX_LAYER, STRATURILE MICI SUNT DESENATE PRIMELE
+	int depth; // ORDINEA IN CADRUL ACELUIASI STRAT, SHADER SI TEXTURI, INTRE 0 SI RenderQueue::MAX_DEPTH
+
+	Entity* entity = nullptr; // COMPLETAT DE Entity::AddComponent
+
+private:
+
+	// VARFURILE IN COORDONATELE LUMII (CAMERA E APLICATA DE SHADER), RECALCULATE DOAR CAND SE SCHIMBA CEVA DIN CE E MAI JOS
+	float vertexData[24];
+	bool hasVertexData = false;
+
+	Scalar cachedX = 0.0;
+	Scalar cachedY = 0.0;
+	Scalar cachedWidth = 0.0;
+	Scalar cachedHeight = 0.0;
+	unsigned int cachedTextureID = 0;
+
+	int unchangedSubmits = 0;
+	int changedSubmits = 0;
+	bool isStatic = false;
+
+	bool wasSubmittedAsStatic = false;
+	long long lastSubmittedFlush = -2;
+
+	void ComputeVertexData()
+	{
+		float left = this->cachedX - this->cachedWidth / 2.0;
+		float right = this->cachedX + this->cachedWidth / 2.0;
+		float bottom = this->cachedY - this->cachedHeight / 2.0;
+		float top = this->cachedY + this->cachedHeight / 2.0;
+
+		int dataSize = 0;
+
+		// TEXTURILE AU ORIGINEA O(0, 0) IN COLTUL DE SUS DIN STANGA
+
+		/*
+		6-------3/4
+		|        |
+		|        |
+		|        |
+		1/5------2
+		*/
+
+		this->vertexData[dataSize++] = left;
+		this->vertexData[dataSize++] = bottom;
+
+		this->vertexData[dataSize++] = 0.0;
+		this->vertexData[dataSize++] = 1.0;
+
+		this->vertexData[dataSize++] = right;
+		this->vertexData[dataSize++] = bottom;
+
+		this->vertexData[dataSize++] = 1.0;
+		this->vertexData[dataSize++] = 1.0;
+
+		this->vertexData[dataSize++] = right;
+		this->vertexData[dataSize++] = top;
+
+		this->vertexData[dataSize++] = 1.0;
+		this->vertexData[dataSize++] = 0.0;
+
+		this->vertexData[dataSize++] = right;
+		this->vertexData[dataSize++] = top;
+
+		this->vertexData[dataSize++] = 1.0;
+		this->vertexData[dataSize++] = 0.0;
+
+		this->vertexData[dataSize++] = left;
+		this->vertexData[dataSize++] = bottom;
+
+		this->vertexData[dataSize++] = 0.0;
+		this->vertexData[dataSize++] = 1.0;
+
+		this->vertexData[dataSize++] = left;
+		this->vertexData[dataSize++] = top;
+
+		this->vertexData[dataSize++] = 0.0;
+		this->vertexData[dataSize++] = 0.0;
+	}
+};
+
+inline void Camera2D::Update(double deltaTime)
+{
+	this->PlaceIfNeeded();
+
+	Entity* entity = this->followedEntity;
+
+	if (entity == nullptr && this->followsPlayer && Player::Get()->ShouldCameraFollowPlayer())
+	{
+		entity = Player::Get()->GetEntity();
+	}
+
+	// FARA ENTITATE DE URMARIT (SAU FARA POZITIE), CAMERA RAMANE UNDE ESTE
+	if (entity != nullptr && entity->HasComponent<Position2D>())
+	{
+		this->targetX = entity->GetComponent<Position2D>()->x;
+		this->targetY = entity->GetComponent<Position2D>()->y;
+	}
+
+	if (this->smoothing > 0.0)
+	{
+		// INDEPENDENT DE DURATA CADRELOR: DUPA t SECUNDE RAMANE exp(-t / smoothing) DIN DISTANTA
+		double ratio = 1.0 - std::exp(-std::max(0.0, deltaTime) / this->smoothing);
+
+		this->x += (this->targetX - this->x) * ratio;
+		this->y += (this->targetY - this->y) * ratio;
+	}
+	else
+	{
+		this->x = this->targetX;
+		this->y = this->targetY;
+	}
+
+	this->ClampToBounds();
+}
+
+class Speed2D
+{
+public:
+
+	Speed2D(Scalar speedX = 0.0, Scalar speedY = 0.0) : speedX(speedX), speedY(speedY) {};
+
+	Scalar speedX;
+	Scalar speedY;
+
+private:
+
+};
+
+class Acceleration2D
+{
+public:
+
+	Acceleration2D(Scalar accelerationX = 0.0, Scalar accelerationY = 0.0) : accelerationX(accelerationX), accelerationY(accelerationY) {};
+
+	Scalar accelerationX;
+	Scalar accelerationY;
+
+private:
+
+};
+
+class Gravity2D
+{
+public:
+
+	Gravity2D(Scalar value = 10.0) : value(value) {};
+
+	Scalar value;
+
+private:
+
+};
+
+class Animation2D
+{
+public:
+
+	// clipSet ESTE HANDLE-UL INTORS DE AnimationManager::CreateClipSet. CADRELE SUNT TINUTE O SINGURA DATA IN MANAGER, NU IN FIECARE ENTITATE
+	Animation2D(int clipSet) : clipSet(clipSet)
+	{
+		this->currentEntityAnimation = EntityAnimation::null;
+
+		this->stateChangeQueued = false;
+	}
+
+	// ANIMATIA CORESPUNZATOARE SEMNULUI VITEZEI (STANDING DOAR CAND AMBELE COMPONENTE SUNT 0)
+	static EntityAnimation SelectEntityAnimation(const Speed2D* speed)
+	{
+		if (speed->speedY == 0.0)
+		{
+			if (speed->speedX == 0.0)
+			{
+				return EntityAnimation::standing;
+			}
+			else if (speed->speedX > 0.0)
+			{
+				return EntityAnimation::walkingRight;
+			}
+			else
+			{
+				return EntityAnimation::walkingLeft;
+			}
+		}
+		else if (speed->speedY > 0.0)
+		{
+			if (speed->speedX >= 0.0)
+			{
+				return EntityAnimation::jumpingRight;
+			}
+			else
+			{
+				return EntityAnimation::jumpingLeft;
+			}
+		}
+		else
+		{
+			if (speed->speedX >= 0.0)
+			{
+				return EntityAnimation::fallingRight;
+			}
+			else
+			{
+				return EntityAnimation::fallingLeft;
+			}
+		}
+	}
+
+	// DACA SEMNUL VITEZEI CERE ALTA ANIMATIE, ENTITATEA E PUSA IN COADA PE CARE O PROCESEAZA AnimationManager
+	void CheckEntityAnimation(Entity* entity, const Speed2D* speed)
+	{
+		if (!this->stateChangeQueued && Animation2D::SelectEntityAnimation(speed) != this->currentEntityAnimation)
+		{
+			this->stateChangeQueued = true;
+
+			EntityManager::Get()->animationStateChanges.push_back(entity);
+		}
+	}
+
+	int clipSet;
+
+	int animationIndex = 0;
+
+	EntityAnimation currentEntityAnimation;
+
+	TimingWheelHandle frameTimer; // URMATOAREA SCHIMBARE DE CADRU, PROGRAMATA IN AnimationManager
+
+	bool stateChangeQueued;
+
+private:
+
+};
+
+class MovementSpeed2D
+{
+public:
+
+	MovementSpeed2D(Scalar speedX = 0.0, Scalar speedY = 0.0) : speedX(speedX), speedY(speedY)
+	{
+		this->wentRight = false;
+		this->wentLeft = false;
+	}
+
+	Scalar speedX;
+	Scalar speedY;
+
+	bool wentRight;
+	bool wentLeft;
+
+private:
+
+};
+
+// FUNDAL CARE SE REPETA (PENTRU ENTITATI landScape, CU Texture2D): TEXTURA E DESENATA PE TOT CE VEDE FIECARE CAMERA CU CATE UN SINGUR DREPTUNGHI,
+// DERULATA PRIN COORDONATELE DE TEXTURA. factorX SI factorY SPUN CAT DE REPEDE SE DERULEAZA FATA DE CAMERA (0 E FIX PE ECRAN, 1 SE MISCA ODATA CU LUMEA)
+// COSTUL E ACELASI ORICAT DE LAT AR FI NIVELUL. POZITIA ENTITATII NU CONTEAZA
+class Parallax2D
+{
+public:
+
+	Parallax2D(Scalar tileWidth, Scalar tileHeight, Scalar factorX = 0.5, Scalar factorY = 0.5, int layer = RenderQueue::MIN_LAYER)
+		: tileWidth(tileWidth), tileHeight(tileHeight), factorX(factorX), factorY(factorY), layer(layer) {};
+
+	// TRIMITE DREPTUNGHIUL IN RenderQueue. DEFINIT DUPA GameEngine
+	void Render(Renderer2D* renderer2D);
+
+	Scalar tileWidth; // CAT OCUPA O REPETARE A TEXTURII, IN UNITATI ALE LUMII
+	Scalar tileHeight;
+
+	Scalar factorX;
+	Scalar factorY;
+
+	Scalar scrollSpeedX = 0.0; // DERULARE CONTINUA, INDIFERENT DE CAMERA (NORI), IN UNITATI PE SECUNDA
+	Scalar scrollSpeedY = 0.0;
+
+	int layer; // FUNDALURILE STAU IMPLICIT IN CEL MAI DE JOS STRAT, IAR ORDINEA INTRE ELE E DATA DE depth
+	int depth = 0;
+
+	Entity* entity = nullptr; // COMPLETAT DE Entity::AddComponent
+
+private:
+
+};
+
+#ifdef GAMEENGINE_COROUTINES
+
+// CLASA BEHAVIOR FRAME POOL
+
+// ALOCATOR PENTRU CADRELE CORUTINELOR DE COMPORTAMENT. BLOCURILE SUNT GRUPATE PE CLASE DE MARIME DE CATE 64 DE OCTETI
+// SI NU SE ELIBEREAZA NICIODATA, DOAR SE REFOLOSESC, ASA CA PORNIREA UNUI COMPORTAMENT NU AJUNGE LA new IN REGIM STABIL
+class BehaviorFramePool
+{
+public:
+
+	static BehaviorFramePool* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->behaviorFramePool == nullptr)
+		{
+			world->behaviorFramePool = new BehaviorFramePool();
+		}
+
+		return world->behaviorFramePool;
+	}
+
+	void* Allocate(std::size_t size)
+	{
+		int sizeClass = this->GetSizeClass(size);
+
+		if (sizeClass >= BehaviorFramePool::SIZE_CLASSES)
+		{
+			return ::operator new(size);
+		}
+
+		if (this->freeBlocks[sizeClass].empty())
+		{
+			// UN CHUNK NOU, TAIAT IN BLOCURI DE ACEEASI MARIME
+			std::size_t blockSize = (std::size_t)(sizeClass + 1) * BehaviorFramePool::GRANULARITY;
+			char* chunk = nullptr;
+
+			if (this->arena != nullptr)
+			{
+				chunk = (char*)this->arena->Allocate(blockSize * BehaviorFramePool::BLOCKS_PER_CHUNK);
+			}
+			else
+			{
+				chunk = (char*)::operator new(blockSize * BehaviorFramePool::BLOCKS_PER_CHUNK);
+				this->chunks.push_back(chunk);
+			}
+
+			for (int i = BehaviorFramePool::BLOCKS_PER_CHUNK - 1; i >= 0; i--)
+			{
+				this->freeBlocks[sizeClass].push_back(chunk + i * blockSize);
+			}
+
+			this->reservedBytes += blockSize * BehaviorFramePool::BLOCKS_PER_CHUNK;
+		}
+
+		void* block = this->freeBlocks[sizeClass].back();
+		this->freeBlocks[sizeClass].pop_back();
+
+		this->liveFrames++;
+
+		return block;
+	}
+
+	void Free(void* block, std::size_t size)
+	{
+		int sizeClass = this->GetSizeClass(size);
+
+		if (sizeClass >= BehaviorFramePool::SIZE_CLASSES)
+		{
+			::operator delete(block);
+
+			return;
+		}
+
+		this->freeBlocks[sizeClass].push_back(block);
+
+		this->liveFrames--;
+	}
+
+	// ELIBERAT DOAR ODATA CU LUMEA, CAND NU MAI EXISTA CORUTINE
+	~BehaviorFramePool()
+	{
+		for (int i = 0; i < this->chunks.size(); i++)
+		{
+			::operator delete(this->chunks[i]);
+		}
+	}
+
+	int GetLiveFrameCount()
+	{
+		return this->liveFrames;
+	}
+
+	std::size_t GetReservedBytes()
+	{
+		return this->reservedBytes;
+	}
+
+private:
+
+	static const int GRANULARITY = 64;
+	static const int SIZE_CLASSES = 16;
+	static const int BLOCKS_PER_CHUNK = 32;
+
+	std::vector<void*> freeBlocks[BehaviorFramePool::SIZE_CLASSES];
+	std::vector<char*> chunks;
+
+	MemoryArena* arena; // ARENA LUMII IN CARE A FOST CREAT POOL-UL (SAU nullptr)
+
+	int liveFrames = 0;
+	std::size_t reservedBytes = 0;
+
+	int GetSizeClass(std::size_t size)
+	{
+		return (int)((size + BehaviorFramePool::GRANULARITY - 1) / BehaviorFramePool::GRANULARITY) - 1;
+	}
+
+	BehaviorFramePool()
+	{
+		this->arena = World::GetCurrent()->GetArena();
+	}
+
+	BehaviorFramePool(const BehaviorFramePool&) = delete;
+};
+
+// CLASA ARTIFICIAL INTELLIGENCE BEHAVIOR
+
+// PE CE ASTEAPTA UN COMPORTAMENT SUSPENDAT
+enum class BehaviorWait
+{
+	none = 0,
+	time = 1,
+	playerWithin = 2,
+	grounded = 3,
+};
+
+// UN COMPORTAMENT SCRIS CA CORUTINA, DE EXEMPLU:
+//
+// ArtificialIntelligenceBehavior Guard(Entity* self)
+// {
+//     while (true)
+//     {
+//         co_await UntilPlayerWithin(300.0);
+//         ArtificialIntelligenceManager::Get()->StepTowardsPlayer(self);
+//         co_await WaitSeconds(2.0);
+//     }
+// }
+//
+// SE ATASEAZA CU ArtificialIntelligenceManager::SetBehavior. CAT TIMP E SUSPENDAT NU COSTA NIMIC PE CADRU: ESTE RELUAT DOAR
+// CAND EXPIRA TIMPUL, CAND JUCATORUL INTRA IN RAZA SAU CAND CollisionManager GASESTE ENTITATEA PE SOL
+class ArtificialIntelligenceBehavior
+{
+public:
+
+	struct promise_type
+	{
+		Entity* entity = nullptr;
+
+		BehaviorWait wait = BehaviorWait::none;
+		double wakeTime = 0.0;
+		double radius = 0.0;
+
+		ArtificialIntelligenceBehavior get_return_object()
+		{
+			return ArtificialIntelligenceBehavior(std::coroutine_handle<promise_type>::from_promise(*this));
+		}
+
+		// PORNESTE ABIA CAND E PRELUAT DE ArtificialIntelligenceManager (CARE STIE ENTITATEA)
+		std::suspend_always initial_suspend() noexcept
+		{
+			return {};
+		}
+
+		std::suspend_always final_suspend() noexcept
+		{
+			return {};
+		}
+
+		void return_void() {}
+
+		void unhandled_exception()
+		{
+			std::cout << "ERROR :: ARTIFICIAL INTELLIGENCE BEHAVIOR :: UNHANDLED EXCEPTION INSIDE A BEHAVIOR. TERMINATING...\n";
+
+			std::terminate();
+		}
+
+		static void* operator new(std::size_t size)
+		{
+			return BehaviorFramePool::Get()->Allocate(size);
+		}
+
+		static void operator delete(void* block, std::size_t size)
+		{
+			BehaviorFramePool::Get()->Free(block, size);
+		}
+	};
+
+	ArtificialIntelligenceBehavior() {};
+
+	ArtificialIntelligenceBehavior(ArtificialIntelligenceBehavior&& other) noexcept : handle(other.handle)
+	{
+		other.handle = nullptr;
+	}
+
+	ArtificialIntelligenceBehavior& operator=(ArtificialIntelligenceBehavior&& other) noexcept
+	{
+		if (this != &other)
+		{
+			this->Destroy();
+
+			this->handle = other.handle;
+			other.handle = nullptr;
+		}
+
+		return *this;
+	}
+
+	~ArtificialIntelligenceBehavior()
+	{
+		this->Destroy();
+	}
+
+	bool IsValid() const
+	{
+		return this->handle != nullptr;
+	}
+
+	bool IsDone() const
+	{
+		return this->handle == nullptr || this->handle.done();
+	}
+
+	promise_type& GetPromise()
+	{
+		return this->handle.promise();
+	}
+
+	void Resume()
+	{
+		this->handle.promise().wait = BehaviorWait::none;
+
+		this->handle.resume();
+	}
+
+	void Destroy()
+	{
+		if (this->handle != nullptr)
+		{
+			this->handle.destroy();
+			this->handle = nullptr;
+		}
+	}
+
+private:
+
+	std::coroutine_handle<promise_type> handle = nullptr;
+
+	explicit ArtificialIntelligenceBehavior(std::coroutine_handle<promise_type> handle) : handle(handle) {};
+
+	ArtificialIntelligenceBehavior(const ArtificialIntelligenceBehavior&) = delete;
+	ArtificialIntelligenceBehavior& operator=(const ArtificialIntelligenceBehavior&) = delete;
+};
+
+// co_await WaitSeconds(2.0) - RELUARE DUPA UN NUMAR DE SECUNDE DE JOC (0 = IN CADRUL URMATOR)
+struct WaitSeconds
+{
+	double seconds;
+
+	WaitSeconds(double seconds) : seconds(seconds) {};
+
+	bool await_ready() const noexcept
+	{
+		return false;
+	}
+
+	void await_suspend(std::coroutine_handle<ArtificialIntelligenceBehavior::promise_type> handle) const noexcept
+	{
+		handle.promise().wait = BehaviorWait::time;
+		handle.promise().wakeTime = TimeManager::Get()->GetCurrentTime() + this->seconds;
+	}
+
+	void await_resume() const noexcept {}
+};
+
+// co_await UntilPlayerWithin(300.0) - RELUARE CAND JUCATORUL AJUNGE LA CEL MULT radius PIXELI DE ENTITATE
+struct UntilPlayerWithin
+{
+	double radius;
+
+	UntilPlayerWithin(double radius) : radius(radius) {};
+
+	bool await_ready() const noexcept
+	{
+		return false;
+	}
+
+	bool await_suspend(std::coroutine_handle<ArtificialIntelligenceBehavior::promise_type> handle) const noexcept
+	{
+		Entity* entity = handle.promise().entity;
+		Entity* player = Player::Get()->GetEntity();
+
+		if (player != nullptr && player->HasComponent<Position2D>() && entity->HasComponent<Position2D>())
+		{
+			double distanceX = player->GetComponent<Position2D>()->x - entity->GetComponent<Position2D>()->x;
+			double distanceY = player->GetComponent<Position2D>()->y - entity->GetComponent<Position2D>()->y;
+
+			if (distanceX * distanceX + distanceY * distanceY <= this->radius * this->radius)
+			{
+				return false; // CONDITIA E DEJA INDEPLINITA, CONTINUA FARA SUSPENDARE
+			}
+		}
+
+		handle.promise().wait = BehaviorWait::playerWithin;
+		handle.promise().radius = this->radius;
+
+		return true;
+	}
+
+	void await_resume() const noexcept {}
+};
+
+// co_await UntilGrounded() - RELUARE CAND ENTITATEA STA PE TEREN
+struct UntilGrounded
+{
+	bool await_ready() const noexcept
+	{
+		return false;
+	}
+
+	bool await_suspend(std::coroutine_handle<ArtificialIntelligenceBehavior::promise_type> handle) const noexcept
+	{
+		Entity* entity = handle.promise().entity;
+
+		if (entity->HasComponent<Hitbox2D>() && entity->GetComponent<Hitbox2D>()->collidedDownward)
+		{
+			return false;
+		}
+
+		handle.promise().wait = BehaviorWait::grounded;
+
+		return true;
+	}
+
+	void await_resume() const noexcept {}
+};
+
+#endif
+
+// NIVELUL DE DETALIU LA CARE E SIMULATA O ENTITATE CU AI, DUPA DISTANTA PANA LA JUCATOR
+enum class ArtificialIntelligenceBand
+{
+	sleeping = 0,
+	nearPlayer = 1,
+	midRange = 2,
+	awake = 3, // TREZITA EXPLICIT, SE COMPORTA CA nearPlayer PANA EXPIRA
+};
+
+class ArtificialIntelligence2D
+{
+public:
+
+	ArtificialIntelligence2D(ArtificialIntelligence state) : state(state)
+	{
+		this->band = ArtificialIntelligenceBand::sleeping;
+
+		this->phase = 0;
+
+		this->lastSeenFrame = -1;
+		this->lastTickFrame = -1;
+		this->awakeUntilFrame = -1;
+
+		this->isPending = false;
+		this->pendingSinceFrame = -1;
+		this->distanceToPlayer = 0.0;
+
+		this->waitsForGround = false;
+	}
+
+	bool HasBehavior()
+	{
+#ifdef GAMEENGINE_COROUTINES
+		return this->behavior.IsValid();
+#else
+		return false;
+#endif
+	}
+
+	ArtificialIntelligence state;
+
+	ArtificialIntelligenceBand band;
+
+	int phase; // DECALAJUL FATA DE CELELALTE ENTITATI DIN BANDA MEDIE, CA SA NU FIE TOATE ACTUALIZATE IN ACELASI CADRU
+
+	long long lastSeenFrame;
+	long long lastTickFrame;
+	long long awakeUntilFrame;
+
+	// STAREA IN PLANIFICATORUL CU BUGET DE TIMP DIN ArtificialIntelligenceManager
+	bool isPending;
+	long long pendingSinceFrame;
+	double distanceToPlayer;
+
+	// COMPORTAMENTUL CA CORUTINA (DACA EXISTA, ENTITATEA NU MAI E ACTUALIZATA PRIN LOGICA DIN ArtificialIntelligenceManager)
+#ifdef GAMEENGINE_COROUTINES
+	ArtificialIntelligenceBehavior behavior;
+#endif
+	TimingWheelHandle behaviorTimer;
+	bool waitsForGround;
+
+private:
+
+};
+
+// EVENIMENTE DE INPUT
+
+// O TASTA APASATA SAU ELIBERATA, CU MOMENTUL LA CARE A APARUT (IN TIMPUL SURSEI CARE A PRODUS-O)
+struct InputEvent
+{
+	int key = 0;
+	bool pressed = false;
+	double timestamp = 0.0;
+};
+
+// DE UNDE VIN EVENIMENTELE DE INPUT. IMPLICIT E FEREASTRA, DAR SE POATE INLOCUI (RULARI FARA FEREASTRA, BOTI, TESTE)
+class InputSource
+{
+public:
+
+	virtual ~InputSource() {}
+
+	// ADAUGA IN events TOATE EVENIMENTELE APARUTE DE LA APELUL ANTERIOR
+	virtual void PollEvents(std::vector<InputEvent>& events) = 0;
+
+	// TIMPUL CURENT AL SURSEI, ACELASI CEAS CU CEL DIN InputEvent::timestamp
+	virtual double GetTime() = 0;
+};
+
+// EVENIMENTELE VIN PRIN CALLBACK-UL DE TASTATURA AL GLFW, DECI O APASARE MAI SCURTA DECAT UN CADRU NU MAI SE PIERDE
+class WindowInputSource : public InputSource
+{
+public:
+
+	void PollEvents(std::vector<InputEvent>& events) override
+	{
+		if (WindowManager::Get()->GetWindow() == nullptr)
+		{
+			return;
+		}
+
+		// callbackEvents E COMUN, IAR CALLBACK-UL E APELAT DE glfwPollEvents, PE FIRUL PRINCIPAL
+		assert(IsMainThread());
+
+		if (this->installedWindow != WindowManager::Get()->GetWindow())
+		{
+			this->installedWindow = WindowManager::Get()->GetWindow();
+
+			glfwSetKeyCallback(this->installedWindow, WindowInputSource::KeyCallback);
+		}
+
+		// EVENIMENTELE AU FOST DEJA CITITE DE glfwPollEvents DIN WindowManager::UpdateWindow
+		events.insert(events.end(), WindowInputSource::callbackEvents.begin(), WindowInputSource::callbackEvents.end());
+		WindowInputSource::callbackEvents.clear();
+	}
+
+	double GetTime() override
+	{
+		return glfwGetTime();
+	}
+
+private:
+
+	static std::vector<InputEvent> callbackEvents;
+
+	GLFWwindow* installedWindow = nullptr;
+
+	static void KeyCallback(GLFWwindow*, int key, int, int action, int)
+	{
+		if (action == GLFW_REPEAT)
+		{
+			return;
+		}
+
+		InputEvent event;
+		event.key = key;
+		event.pressed = (action == GLFW_PRESS);
+		event.timestamp = glfwGetTime();
+
+		WindowInputSource::callbackEvents.push_back(event);
+	}
+};
+
+std::vector<InputEvent> WindowInputSource::callbackEvents;
+
+// EVENIMENTE PROGRAMATE DINAINTE, IN TIMPUL SIMULARII (TimeManager). UN EVENIMENT E LIVRAT IN PRIMUL CADRU IN CARE TIMPUL IL DEPASESTE
+class ScriptedInputSource : public InputSource
+{
+public:
+
+	void AddEvent(double timestamp, int key, bool pressed)
+	{
+		InputEvent event;
+		event.key = key;
+		event.pressed = pressed;
+		event.timestamp = timestamp;
+
+		std::vector<InputEvent>::iterator position = std::upper_bound(this->scriptedEvents.begin() + this->nextEvent, this->scriptedEvents.end(), event,
+			[](const InputEvent& first, const InputEvent& second) { return first.timestamp < second.timestamp; });
+
+		this->scriptedEvents.insert(position, event);
+	}
+
+	void PollEvents(std::vector<InputEvent>& events) override
+	{
+		double currentTime = this->GetTime();
+
+		while (this->nextEvent < this->scriptedEvents.size() && this->scriptedEvents[this->nextEvent].timestamp <= currentTime)
+		{
+			events.push_back(this->scriptedEvents[this->nextEvent]);
+			this->nextEvent++;
+		}
+	}
+
+	double GetTime() override
+	{
+		return TimeManager::Get()->GetCurrentTime();
+	}
+
+	bool IsFinished()
+	{
+		return this->nextEvent == this->scriptedEvents.size();
+	}
+
+	void Clear()
+	{
+		this->scriptedEvents.clear();
+		this->nextEvent = 0;
+	}
+
+private:
+
+	std::vector<InputEvent> scriptedEvents;
+	int nextEvent = 0;
+};
+
+// LATENTA DINTRE APARITIA UNUI EVENIMENT SI MOMENTUL IN CARE SIMULAREA IL FOLOSESTE (IN MILISECUNDE)
+struct InputLatencyStatistics
+{
+	int eventCount = 0;
+
+	double averageLatency = 0.0;
+	double maxLatency = 0.0;
+};
+
+// CLASA USER INPUT MANAGER
+
+class UserInputManager
+{
+public:
+
+	static UserInputManager* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->userInputManager == nullptr)
+		{
+			world->userInputManager = new UserInputManager();
+		}
+
+		return world->userInputManager;
+	}
+
+	// CONSUMA EVENIMENTELE DIN COADA SI LE APLICA JUCATORULUI. E APELAT CAT MAI TARZIU IN CADRU, CHIAR INAINTE DE MISCARE (VEZI GameEngine::UpdateSystems)
+	void ListenForInput()
+	{
+		if (!this->usesExternalKeyState)
+		{
+			this->keyState = this->ConsumeEvents();
+		}
+
+		if (this->keyState & Input::KEY_ESCAPE)
+		{
+			this->gameEngineShouldStop = true;
+		}
+
+		if (Player::Get()->GetEntity() == nullptr)
+		{
+			std::cout << "WARNING :: USERINPUTMANAGER :: LISTENFORINPUT :: PLAYER ENTITY HAS NOT BEEN SET YET\n";
+
+			return;
+		}
+
+		if (Player::Get()->GetEntity()->HasComponent<Speed2D, MovementSpeed2D>())
+		{
+
+			if (this->keyState & Input::KEY_RIGHT)
+			{
+				if (!Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentRight)
+				{
+					Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentRight = true;
+
+					Player::Get()->GetEntity()->GetComponent<Speed2D>()->speedX += Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->speedX;
+				}
+			}
+			else if (Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentRight)
+			{
+				Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentRight = false;
+
+				Player::Get()->GetEntity()->GetComponent<Speed2D>()->speedX -= Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->speedX;
+			}
+
+			if (this->keyState & Input::KEY_LEFT)
+			{
+				if (!Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentLeft)
+				{
+					Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentLeft = true;
+
+					Player::Get()->GetEntity()->GetComponent<Speed2D>()->speedX -= Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->speedX;
+				}
+			}
+			else if (Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentLeft)
+			{
+				Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->wentLeft = false;
+
+				Player::Get()->GetEntity()->GetComponent<Speed2D>()->speedX += Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->speedX;
+			}
+
+			if (this->keyState & Input::KEY_JUMP)
+			{
+				if (Player::Get()->GetEntity()->HasComponent<Hitbox2D>())
+				{
+					if (Player::Get()->GetEntity()->GetComponent<Hitbox2D>()->collidedDownward)
+					{
+						Player::Get()->GetEntity()->GetComponent<Hitbox2D>()->collidedDownward = false;
+
+						Player::Get()->GetEntity()->GetComponent<Speed2D>()->speedY += Player::Get()->GetEntity()->GetComponent<MovementSpeed2D>()->speedY;
+					}
+				}
+			}
+		}
+	}
+
+	// SURSA DE EVENIMENTE (nullptr REVINE LA FEREASTRA). EVENIMENTELE RAMASE NECONSUMATE DIN SURSA VECHE SE PIERD
+	void SetInputSource(InputSource* inputSource)
+	{
+		if (inputSource == nullptr)
+		{
+			inputSource = &this->windowInputSource;
+		}
+
+		if (this->inputSource != inputSource)
+		{
+			this->inputSource = inputSource;
+
+			this->events.clear();
+			this->heldKeys.clear();
+		}
+	}
+
+	InputSource* GetInputSource()
+	{
+		return this->inputSource;
+	}
+
+	// LEAGA O TASTA (CODUL GLFW) DE O ACTIUNE DIN Input. MAI MULTE TASTE POT DA ACEEASI ACTIUNE
+	void BindKey(int key, unsigned char action)
+	{
+		this->keyBindings[key] = action;
+	}
+
+	void UnbindKey(int key)
+	{
+		this->keyBindings.erase(key);
+		this->heldKeys.erase(key);
+	}
+
+	void ClearKeyBindings()
+	{
+		this->keyBindings.clear();
+		this->heldKeys.clear();
+	}
+
+	// CAND E ACTIVAT, ListenForInput NU MAI CONSUMA EVENIMENTE SI FOLOSESTE STAREA DATA PRIN SetKeyState (REPLAY)
+	void SetUsesExternalKeyState(bool state)
+	{
+		this->usesExternalKeyState = state;
+	}
+
+	void SetKeyState(unsigned char keyState)
+	{
+		this->keyState = keyState;
+	}
+
+	// ACTIUNILE ACTIVE IN CADRUL CURENT: CELE TINUTE APASATE PLUS CELE APASATE SI ELIBERATE IN ACELASI CADRU
+	unsigned char GetKeyState()
+	{
+		return this->keyState;
+	}
+
+	InputLatencyStatistics GetLastFrameLatency()
+	{
+		return this->lastFrameLatency;
+	}
+
+	InputLatencyStatistics GetLatencyStatistics()
+	{
+		return this->totalLatency;
+	}
+
+	void ResetLatencyStatistics()
+	{
+		this->lastFrameLatency = InputLatencyStatistics();
+		this->totalLatency = InputLatencyStatistics();
+	}
+
+	bool ShouldGameEngineStop()
+	{
+		return this->gameEngineShouldStop;
+	}
+
+private:
+
+	bool gameEngineShouldStop;
+
+	unsigned char keyState;
+	bool usesExternalKeyState;
+
+	WindowInputSource windowInputSource;
+	ScriptedInputSource emptyInputSource;
+	InputSource* inputSource;
+
+	std::vector<InputEvent> events;
+
+	std::unordered_map<int, unsigned char> keyBindings;
+	std::unordered_set<int> heldKeys;
+
+	InputLatencyStatistics lastFrameLatency;
+	InputLatencyStatistics totalLatency;
+
+	unsigned char ConsumeEvents()
+	{
+		this->inputSource->PollEvents(this->events);
+
+		double consumeTime = this->inputSource->GetTime();
+
+		unsigned char pressedThisFrame = 0;
+
+		this->lastFrameLatency = InputLatencyStatistics();
+
+		for (int i = 0; i < this->events.size(); i++)
+		{
+			double latency = (consumeTime - this->events[i].timestamp) * 1000.0;
+
+			this->lastFrameLatency.eventCount++;
+			this->lastFrameLatency.averageLatency += latency;
+			this->lastFrameLatency.maxLatency = std::max(this->lastFrameLatency.maxLatency, latency);
+
+			std::unordered_map<int, unsigned char>::iterator binding = this->keyBindings.find(this->events[i].key);
+
+			if (binding == this->keyBindings.end())
+			{
+				continue;
+			}
+
+			if (this->events[i].pressed)
+			{
+				this->heldKeys.insert(this->events[i].key);
+
+				pressedThisFrame |= binding->second;
+			}
+			else
+			{
+				this->heldKeys.erase(this->events[i].key);
+			}
+		}
+
+		this->events.clear();
+
+		if (this->lastFrameLatency.eventCount > 0)
+		{
+			this->totalLatency.averageLatency = (this->totalLatency.averageLatency * this->totalLatency.eventCount + this->lastFrameLatency.averageLatency)
+				/ (this->totalLatency.eventCount + this->lastFrameLatency.eventCount);
+			this->totalLatency.eventCount += this->lastFrameLatency.eventCount;
+			this->totalLatency.maxLatency = std::max(this->totalLatency.maxLatency, this->lastFrameLatency.maxLatency);
+
+			this->lastFrameLatency.averageLatency /= this->lastFrameLatency.eventCount;
+		}
+
+		unsigned char state = pressedThisFrame;
+
+		for (std::unordered_set<int>::iterator it = this->heldKeys.begin(); it != this->heldKeys.end(); it++)
+		{
+			state |= this->keyBindings[*it];
+		}
+
+		return state;
+	}
+
+	UserInputManager()
+	{
+		this->gameEngineShouldStop = false;
+
+		this->keyState = 0;
+		this->usesExternalKeyState = false;
+
+		// DOAR LUMEA IMPLICITA CITESTE FEREASTRA. CELELALTE (DE OBICEI PE ALTE FIRE) PORNESC FARA INPUT, PANA LI SE DA O SURSA
+		if (World::GetCurrent() == World::GetDefault())
+		{
+			this->inputSource = &this->windowInputSource;
+		}
+		else
+		{
+			this->inputSource = &this->emptyInputSource;
+		}
+
+		this->keyBindings[GLFW_KEY_ESCAPE] = Input::KEY_ESCAPE;
+		this->keyBindings[GLFW_KEY_D] = Input::KEY_RIGHT;
+		this->keyBindings[GLFW_KEY_A] = Input::KEY_LEFT;
+		this->keyBindings[GLFW_KEY_SPACE] = Input::KEY_JUMP;
+	}
+
+	UserInputManager(const UserInputManager&) = delete;
+};
+
+// CLASA MOVEMENT MANAGER
+
+class MovementManager
+{
+public:
+
+	static MovementManager* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->movementManager == nullptr)
+		{
+			world->movementManager = new MovementManager();
+		}
+
+		return world->movementManager;
+	}
+
+	void UpdateMovements()
+	{
+		EntityManager* entityManager = EntityManager::Get();
+
+		// PASUL DE TIMP E CONVERTIT O SINGURA DATA, CA TOATE CALCULELE DE MAI JOS SA RAMANA IN Scalar
+		Scalar deltaTime = (Scalar)TimeManager::Get()->GetDeltaTime();
+
+		for (int i = 0; i < entityManager->characters.size(); i++)
+		{
+			if (entityManager->characters[i]->HasComponent<Speed2D>())
+			{
+				// STAREA ANIMATIEI SE DECIDE DIN VITEZA DE LA INCEPUTUL PASULUI DE MISCARE (DUPA COLIZIUNI SI INPUT)
+				if (entityManager->characters[i]->HasComponent<Animation2D>())
+				{
+					entityManager->characters[i]->GetComponent<Animation2D>()->CheckEntityAnimation(entityManager->characters[i], entityManager->characters[i]->GetComponent<Speed2D>());
+				}
+
+				if (entityManager->characters[i]->HasComponent<Gravity2D>())
+				{
+					entityManager->characters[i]->GetComponent<Speed2D>()->speedY += entityManager->characters[i]->GetComponent<Gravity2D>()->value * deltaTime;
+				}
+				if (entityManager->characters[i]->HasComponent<Acceleration2D>())
+				{
+					entityManager->characters[i]->GetComponent<Speed2D>()->speedX += entityManager->characters[i]->GetComponent<Acceleration2D>()->accelerationX * deltaTime;
+					entityManager->characters[i]->GetComponent<Speed2D>()->speedY += entityManager->characters[i]->GetComponent<Acceleration2D>()->accelerationY * deltaTime;
+				}
+
+				if (entityManager->characters[i]->HasComponent<Position2D>())
+				{
+
+					entityManager->characters[i]->GetComponent<Position2D>()->x += entityManager->characters[i]->GetComponent<Speed2D>()->speedX * deltaTime;
+					entityManager->characters[i]->GetComponent<Position2D>()->y += entityManager->characters[i]->GetComponent<Speed2D>()->speedY * deltaTime;
+
+					// UN COMPORTAMENT SUSPENDAT IN UntilPlayerWithin E GASIT DUPA CELULA, DECI CELULA TREBUIE SA-L URMEZE (POATE CADEA SAU FI IMPINS)
+					if (entityManager->characters[i]->HasComponent<ArtificialIntelligence2D>() && entityManager->characters[i]->GetComponent<ArtificialIntelligence2D>()->HasBehavior()
+						&& entityManager->behaviorGrid.Contains(entityManager->characters[i]))
+					{
+						entityManager->behaviorGrid.Update(entityManager->characters[i], entityManager->characters[i]->GetComponent<Position2D>()->x, entityManager->characters[i]->GetComponent<Position2D>()->y);
+					}
+				}
+			}
+		}
+
+		for (int i = 0; i < entityManager->terrains.size(); i++)
+		{
+			if (entityManager->terrains[i]->HasComponent<Speed2D>())
+			{
+				// STAREA ANIMATIEI SE DECIDE DIN VITEZA DE LA INCEPUTUL PASULUI DE MISCARE (DUPA COLIZIUNI SI INPUT)
+				if (entityManager->terrains[i]->HasComponent<Animation2D>())
+				{
+					entityManager->terrains[i]->GetComponent<Animation2D>()->CheckEntityAnimation(entityManager->terrains[i], entityManager->terrains[i]->GetComponent<Speed2D>());
+				}
+
+				if (entityManager->terrains[i]->HasComponent<Position2D>())
+				{
+
+					entityManager->terrains[i]->GetComponent<Position2D>()->x += entityManager->terrains[i]->GetComponent<Speed2D>()->speedX * deltaTime;
+					entityManager->terrains[i]->GetComponent<Position2D>()->y += entityManager->terrains[i]->GetComponent<Speed2D>()->speedY * deltaTime;
+				}
+
+				if (entityManager->terrains[i]->HasComponent<Gravity2D>())
+				{
+					entityManager->terrains[i]->GetComponent<Speed2D>()->speedY += entityManager->terrains[i]->GetComponent<Gravity2D>()->value * deltaTime;
+				}
+				if (entityManager->terrains[i]->HasComponent<Acceleration2D>())
+				{
+					entityManager->terrains[i]->GetComponent<Speed2D>()->speedX += entityManager->terrains[i]->GetComponent<Acceleration2D>()->accelerationX * deltaTime;
+					entityManager->terrains[i]->GetComponent<Speed2D>()->speedY += entityManager->terrains[i]->GetComponent<Acceleration2D>()->accelerationY * deltaTime;
+				}
+			}
+		}
+
+		for (int i = 0; i < entityManager->bullets.size(); i++)
+		{
+			if (entityManager->bullets[i]->HasComponent<Speed2D>())
+			{
+				// STAREA ANIMATIEI SE DECIDE DIN VITEZA DE LA INCEPUTUL PASULUI DE MISCARE (DUPA COLIZIUNI SI INPUT)
+				if (entityManager->bullets[i]->HasComponent<Animation2D>())
+				{
+					entityManager->bullets[i]->GetComponent<Animation2D>()->CheckEntityAnimation(entityManager->bullets[i], entityManager->bullets[i]->GetComponent<Speed2D>());
+				}
+
+				if (entityManager->bullets[i]->HasComponent<Position2D>())
+				{
+
+					entityManager->bullets[i]->GetComponent<Position2D>()->x += entityManager->bullets[i]->GetComponent<Speed2D>()->speedX * deltaTime;
+					entityManager->bullets[i]->GetComponent<Position2D>()->y += entityManager->bullets[i]->GetComponent<Speed2D>()->speedY * deltaTime;
+				}
+
+				if (entityManager->bullets[i]->HasComponent<Gravity2D>())
+				{
+					entityManager->bullets[i]->GetComponent<Speed2D>()->speedY += entityManager->bullets[i]->GetComponent<Gravity2D>()->value * deltaTime;
+				}
+				if (entityManager->bullets[i]->HasComponent<Acceleration2D>())
+				{
+					entityManager->bullets[i]->GetComponent<Speed2D>()->speedX += entityManager->bullets[i]->GetComponent<Acceleration2D>()->accelerationX * deltaTime;
+					entityManager->bullets[i]->GetComponent<Speed2D>()->speedY += entityManager->bullets[i]->GetComponent<Acceleration2D>()->accelerationY * deltaTime;
+				}
+			}
+		}
+	}
+
+private:
+
+	MovementManager() {};
+
+	MovementManager(const MovementManager&) = delete;
+
+};
+
+// CLASA SPATIAL ORDER MANAGER
+
+// CE A FACUT ULTIMA TRECERE DE REORDONARE
+struct SpatialOrderStatistics
+{
+	long long completedPasses = 0;
+
+	int reorderedLists = 0; // LISTELE DIN EntityManager CARE NU ERAU DEJA IN ORDINE
+	int reorderedStorages = 0;
+	int movedComponents = 0;
+
+	int skippedStorages = 0; // NESORTATE PENTRU CA SnapshotManager ARE ISTORIC (VEZI SpatialOrderManager::SetEnabled)
+};
+
+// OPTIONAL (IMPLICIT OPRIT): TINE ENTITATILE APROPIATE IN SPATIU SI IN MEMORIE. LISTELE characters, terrains, bullets DIN EntityManager
+// SI STOCARILE COMPONENTELOR SUNT SORTATE DUPA CHEIA MORTON (Z-ORDER) A POZITIEI (ENTITATILE FARA Position2D LA SFARSIT, IN ORDINEA DE DINAINTE).
+// O TRECERE INCEPE LA FIECARE period CADRE SI E IMPARTITA PE CADRE: INTR-UN CADRU SE SORTEAZA LISTE SI STOCARI INTREGI PANA SE ATINGE BUGETUL
+// DE ELEMENTE. ENTITATILE NU SE MUTA (POINTERII LA ELE RAMAN VALIZI), DOAR COMPONENTELE, IAR CE E DEJA IN ORDINE NU E ATINS.
+// O STOCARE REORDONATA INVALIDEAZA SNAPSHOT-URILE MAI VECHI (CA O ADAUGARE SAU O STERGERE), DE ACEEA NU E REORDONATA CAT TIMP EXISTA ISTORIC
+class SpatialOrderManager
+{
+public:
+
+	static SpatialOrderManager* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->spatialOrderManager == nullptr)
+		{
+			world->spatialOrderManager = new SpatialOrderManager();
+		}
+
+		return world->spatialOrderManager;
+	}
+
+	// CAT TIMP SnapshotManager ARE ISTORIC (SetHistoryLength > 0), STOCARILE SALVATE DE SNAPSHOT-URI (CELE TRIVIAL COPIABILE) NU SUNT SORTATE,
+	// ALTFEL ORICE Rollback PESTE O TRECERE AR ESUA. LISTELE DIN EntityManager SI CELELALTE STOCARI SUNT SORTATE IN CONTINUARE
+	void SetEnabled(bool isEnabled)
+	{
+		this->isEnabled = isEnabled;
+	}
+
+	bool IsEnabled()
+	{
+		return this->isEnabled;
+	}
+
+	// LA CATE CADRE INCEPE O TRECERE NOUA
+	void SetPeriod(int period)
+	{
+		this->period = std::max(1, period);
+	}
+
+	// LATURA CELULEI IN CARE POZITIILE SUNT CONSIDERATE EGALE (DE OBICEI CAT O DALA DE TEREN)
+	void SetCellSize(Scalar cellSize)
+	{
+		if (cellSize <= 0.0)
+		{
+			std::cout << "ERROR :: SPATIAL ORDER MANAGER :: SETCELLSIZE :: THE CELL SIZE MUST BE POSITIVE\n";
+
+			return;
+		}
+
+		this->cellSize = cellSize;
+	}
+
+	// CATE ELEMENTE (ENTITATI DIN LISTE SI COMPONENTE) SUNT SORTATE INTR-UN CADRU. O LISTA SAU O STOCARE NU E IMPARTITA, DECI CEL PUTIN UNA PE CADRU
+	void SetBudget(int budget)
+	{
+		this->budget = std::max(1, budget);
+	}
+
+	// APELAT DE GameEngine::UpdateSystems
+	void Update()
+	{
+		if (!this->isEnabled)
+		{
+			return;
+		}
+
+		this->framesSincePass++;
+
+		if (this->nextStep == -1)
+		{
+			if (this->framesSincePass < this->period)
+			{
+				return;
+			}
+
+			this->StartPass();
+		}
+
+		int usedBudget = 0;
+
+		while (this->nextStep != -1 && usedBudget < this->budget)
+		{
+			usedBudget += this->RunStep(this->nextStep);
+
+			this->nextStep++;
+
+			if (this->nextStep == SpatialOrderManager::LIST_STEPS + MAX_COMPONENTS)
+			{
+				this->FinishPass();
+			}
+		}
+	}
+
+	// O TRECERE INTREAGA, ACUM (DE EXEMPLU DUPA INCARCAREA UNUI NIVEL)
+	void ReorderNow()
+	{
+		this->StartPass();
+
+		while (this->nextStep < SpatialOrderManager::LIST_STEPS + MAX_COMPONENTS)
+		{
+			this->RunStep(this->nextStep);
+
+			this->nextStep++;
+		}
+
+		this->FinishPass();
+	}
+
+	const SpatialOrderStatistics& GetStatistics()
+	{
+		return this->statistics;
+	}
+
+	// CELULELE (x / cellSize, y / cellSize), CU BITII INTERCALATI: CELULELE APROPIATE AU DE OBICEI CHEI APROPIATE
+	static std::uint64_t GetMortonKey(Scalar x, Scalar y, Scalar cellSize)
+	{
+		return SpatialOrderManager::SpreadBits(SpatialOrderManager::GetCell(x, cellSize)) | (SpatialOrderManager::SpreadBits(SpatialOrderManager::GetCell(y, cellSize)) << 1);
+	}
+
+private:
+
+	static const int LIST_STEPS = 3; // characters, terrains, bullets, APOI CATE UN PAS PENTRU FIECARE ID DE COMPONENTA
+
+	bool isEnabled = false;
+	int period = 60;
+	Scalar cellSize = 32.0;
+	int budget = 4096;
+
+	int framesSincePass = 0;
+	int nextStep = -1; // -1 CAND NU E NICIO TRECERE IN CURS
+
+	SpatialOrderStatistics statistics;
+	SpatialOrderStatistics currentPass;
+
+	static std::uint64_t GetCell(Scalar coordinate, Scalar cellSize)
+	{
+		// POZITIILE NEGATIVE SUNT DEPLASATE CU 2^31, CA ORDINEA CELULELOR SA SE PASTREZE
+		double cell = std::floor((double)coordinate / cellSize);
+		cell = std::max(-2147483648.0, std::min(2147483647.0, cell));
+
+		return (std::uint64_t)((long long)cell + 2147483648LL);
+	}
+
+	// BITII 0..31 AJUNG PE POZITIILE PARE
+	static std::uint64_t SpreadBits(std::uint64_t value)
+	{
+		value &= 0xFFFFFFFFULL;
+		value = (value | (value << 16)) & 0x0000FFFF0000FFFFULL;
+		value = (value | (value << 8)) & 0x00FF00FF00FF00FFULL;
+		value = (value | (value << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		value = (value | (value << 2)) & 0x3333333333333333ULL;
+		value = (value | (value << 1)) & 0x5555555555555555ULL;
+
+		return value;
+	}
+
+	std::uint64_t GetEntityKey(Entity* entity)
+	{
+		if (!entity->HasComponent<Position2D>())
+		{
+			return ~0ULL;
+		}
+
+		return SpatialOrderManager::GetMortonKey(entity->GetComponent<Position2D>()->x, entity->GetComponent<Position2D>()->y, this->cellSize);
+	}
+
+	// DEFINIT DUPA SnapshotManager
+	bool HasSnapshotHistory();
+
+	void StartPass()
+	{
+		this->nextStep = 0;
+		this->framesSincePass = 0;
+
+		this->currentPass = SpatialOrderStatistics();
+	}
+
+	void FinishPass()
+	{
+		this->nextStep = -1;
+
+		this->currentPass.completedPasses = this->statistics.completedPasses + 1;
+		this->statistics = this->currentPass;
+	}
+
+	// INTOARCE CATE ELEMENTE A AVUT PASUL
+	int RunStep(int step)
+	{
+		if (step == 0)
+		{
+			return this->SortList(EntityManager::Get()->characters);
+		}
+		if (step == 1)
+		{
+			return this->SortList(EntityManager::Get()->terrains);
+		}
+		if (step == 2)
+		{
+			return this->SortList(EntityManager::Get()->bullets);
+		}
+
+		return this->SortStorage(step - SpatialOrderManager::LIST_STEPS);
+	}
+
+	// CHEILE SI ORDINEA NOUA STAU IN MEMORIA CADRULUI. EGALITATILE SUNT DEPARTAJATE DUPA POZITIA VECHE, DECI SORTAREA E STABILA FARA std::stable_sort
+	// (CARE ALOCA UN BUFFER DIN HEAP)
+	int SortList(std::vector<Entity*>& entities)
+	{
+		FrameAllocatorScope scratch;
+
+		int count = (int)entities.size();
+
+		FrameVector<std::pair<std::uint64_t, int>> keys(count);
+
+		bool isSorted = true;
+
+		for (int i = 0; i < count; i++)
+		{
+			keys[i] = { this->GetEntityKey(entities[i]), i };
+
+			if (i > 0 && keys[i].first < keys[i - 1].first)
+			{
+				isSorted = false;
+			}
+		}
+
+		if (!isSorted)
+		{
+			std::sort(keys.begin(), keys.end());
+
+			FrameVector<Entity*> sortedEntities(count);
+			for (int i = 0; i < count; i++)
+			{
+				sortedEntities[i] = entities[keys[i].second];
+			}
+
+			std::copy(sortedEntities.begin(), sortedEntities.end(), entities.begin());
+
+			this->currentPass.reorderedLists++;
+		}
+
+		return count;
+	}
+
+	int SortStorage(ComponentTypeID typeID)
+	{
+		ComponentStorage& storage = ComponentStorageManager::Get()->GetStorage(typeID);
+
+		if (!storage.IsInitialized() || storage.GetCount() < 2)
+		{
+			return 0;
+		}
+
+		if (storage.GetTypeInfo().isTriviallyCopyable && this->HasSnapshotHistory())
+		{
+			this->currentPass.skippedStorages++;
+
+			return 0;
+		}
+
+		FrameAllocatorScope scratch;
+
+		int count = storage.GetCount();
+
+		FrameVector<std::pair<std::uint64_t, int>> keys(count);
+
+		bool isSorted = true;
+
+		for (int i = 0; i < count; i++)
+		{
+			keys[i] = { this->GetEntityKey(storage.GetOwner(i)), i };
+
+			if (i > 0 && keys[i].first < keys[i - 1].first)
+			{
+				isSorted = false;
+			}
+		}
+
+		if (isSorted)
+		{
+			return count;
+		}
+
+		std::sort(keys.begin(), keys.end());
+
+		FrameVector<int> order(count);
+		for (int i = 0; i < count; i++)
+		{
+			order[i] = keys[i].second;
+
+			if (order[i] != i)
+			{
+				this->currentPass.movedComponents++;
+			}
+		}
+
+		storage.Reorder(order.data(), count);
+
+		for (int i = 0; i < count; i++)
+		{
+			storage.GetOwner(i)->componentIndices[typeID] = i;
+		}
+
+		this->currentPass.reorderedStorages++;
+
+		return count;
+	}
+
+	SpatialOrderManager() {};
+
+	SpatialOrderManager(const SpatialOrderManager&) = delete;
+};
+
+// CLASA COLLISION MANAGER
+
+class CollisionManager
+{
+public:
+
+	static CollisionManager* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->collisionManager == nullptr)
+		{
+			world->collisionManager = new CollisionManager();
+		}
+
+		return world->collisionManager;
+	}
+
+	void UpdateCollisions()
+	{
+		EntityManager* entityManager = EntityManager::Get();
+
+		// ADUNATE LOCAL, TRIMISE O DATA LA MetricsRegistry
+		long long aabbTests = 0;
+		long long collisionPushes = 0;
+		long long bulletsRemoved = 0;
+
+		for (int i = 0; i < entityManager->characters.size(); i++)
+		{
+
+			if (!entityManager->characters[i]->HasComponent<Position2D, Hitbox2D>()) continue;
+
+			for (int j = 0; j < entityManager->bullets.size(); j++)
+			{
+				if (!entityManager->bullets[j]->HasComponent<Position2D, Hitbox2D>()) continue;
+
+				aabbTests++;
+
+				if (std::max(entityManager->characters[i]->GetComponent<Position2D>()->x - entityManager->characters[i]->GetComponent<Hitbox2D>()->width / 2, entityManager->bullets[j]->GetComponent<Position2D>()->x - entityManager->bullets[j]->GetComponent<Hitbox2D>()->width / 2) <=
+					std::min(entityManager->characters[i]->GetComponent<Position2D>()->x + entityManager->characters[i]->GetComponent<Hitbox2D>()->width / 2, entityManager->bullets[j]->GetComponent<Position2D>()->x + entityManager->bullets[j]->GetComponent<Hitbox2D>()->width / 2) &&
+					std::max(entityManager->characters[i]->GetComponent<Position2D>()->y - entityManager->characters[i]->GetComponent<Hitbox2D>()->height / 2, entityManager->bullets[j]->GetComponent<Position2D>()->y - entityManager->bullets[j]->GetComponent<Hitbox2D>()->height / 2) <=
+					std::min(entityManager->characters[i]->GetComponent<Position2D>()->y + entityManager->characters[i]->GetComponent<Hitbox2D>()->height / 2, entityManager->bullets[j]->GetComponent<Position2D>()->y + entityManager->bullets[j]->GetComponent<Hitbox2D>()->height / 2))
+				{
+					entityManager->RemoveBullet(j);
+					j--;
+
+					bulletsRemoved++;
+				}
+			}
+		}
+
+		for (int i = 0; i < entityManager->characters.size(); i++)
+		{
+			if (entityManager->characters[i]->HasComponent<Hitbox2D>())
+			{
+				entityManager->characters[i]->GetComponent<Hitbox2D>()->collidedDownward = false;
+			}
+		}
+
+		for (int i = 0; i < entityManager->terrains.size(); i++)
+		{
+			if (!entityManager->terrains[i]->HasComponent<Position2D, Hitbox2D>()) continue;
+
+			for (int j = 0; j < entityManager->characters.size(); j++)
+			{
+				if (!entityManager->characters[j]->HasComponent<Position2D, Hitbox2D>()) continue;
+
+				aabbTests++;
+
+				if (std::max(entityManager->terrains[i]->GetComponent<Position2D>()->x - entityManager->terrains[i]->GetComponent<Hitbox2D>()->width / 2, entityManager->characters[j]->GetComponent<Position2D>()->x - entityManager->characters[j]->GetComponent<Hitbox2D>()->width / 2) <=
+					std::min(entityManager->terrains[i]->GetComponent<Position2D>()->x + entityManager->terrains[i]->GetComponent<Hitbox2D>()->width / 2, entityManager->characters[j]->GetComponent<Position2D>()->x + entityManager->characters[j]->GetComponent<Hitbox2D>()->width / 2) &&
+					std::max(entityManager->terrains[i]->GetComponent<Position2D>()->y - entityManager->terrains[i]->GetComponent<Hitbox2D>()->height / 2, entityManager->characters[j]->GetComponent<Position2D>()->y - entityManager->characters[j]->GetComponent<Hitbox2D>()->height / 2) <=
+					std::min(entityManager->terrains[i]->GetComponent<Position2D>()->y + entityManager->terrains[i]->GetComponent<Hitbox2D>()->height / 2, entityManager->characters[j]->GetComponent<Position2D>()->y + entityManager->characters[j]->GetComponent<Hitbox2D>()->height / 2))
+				{
+					collisionPushes++;
+
+					// COLIZIUNE CU REZOLVARE PE AXA OX
+					if (entityManager->terrains[i]->GetComponent<Hitbox2D>()->width / 2 + entityManager->characters[j]->GetComponent<Hitbox2D>()->width / 2 - std::abs(entityManager->terrains[i]->GetComponent<Position2D>()->x - entityManager->characters[j]->GetComponent<Position2D>()->x) < entityManager->terrains[i]->GetComponent<Hitbox2D>()->height / 2 + entityManager->characters[j]->GetComponent<Hitbox2D>()->height / 2 - std::abs(entityManager->terrains[i]->GetComponent<Position2D>()->y - entityManager->characters[j]->GetComponent<Position2D>()->y))
+					{
+						if (entityManager->terrains[i]->GetComponent<Position2D>()->x < entityManager->characters[j]->GetComponent<Position2D>()->x)
+						{
+							entityManager->characters[j]->GetComponent<Position2D>()->x += entityManager->terrains[i]->GetComponent<Hitbox2D>()->width / 2 + entityManager->characters[j]->GetComponent<Hitbox2D>()->width / 2 - (entityManager->characters[j]->GetComponent<Position2D>()->x - entityManager->terrains[i]->GetComponent<Position2D>()->x);
+
+							if (entityManager->characters[j]->HasComponent<MovementSpeed2D>())
+							{
+								if (entityManager->characters[j]->GetComponent<MovementSpeed2D>()->wentLeft)
+								{
+									entityManager->characters[j]->GetComponent<MovementSpeed2D>()->wentLeft = false;
+								}
+							}
+
+							if (entityManager->characters[j]->HasComponent<Speed2D>())
+							{
+								if (entityManager->characters[j]->GetComponent<Speed2D>()->speedX < 0.0)
+								{
+									entityManager->characters[j]->GetComponent<Speed2D>()->speedX = 0.0;
+								}
+							}
+						}
+						else
+						{
+							entityManager->characters[j]->GetComponent<Position2D>()->x -= entityManager->terrains[i]->GetComponent<Hitbox2D>()->width / 2 + entityManager->characters[j]->GetComponent<Hitbox2D>()->width / 2 - (entityManager->terrains[i]->GetComponent<Position2D>()->x - entityManager->characters[j]->GetComponent<Position2D>()->x);
+
+							if (entityManager->characters[j]->HasComponent<MovementSpeed2D>())
+							{
+								if (entityManager->characters[j]->GetComponent<MovementSpeed2D>()->wentRight)
+								{
+									entityManager->characters[j]->GetComponent<MovementSpeed2D>()->wentRight = false;
+								}
+							}
+
+							if (entityManager->characters[j]->HasComponent<Speed2D>())
+							{
+								if (entityManager->characters[j]->GetComponent<Speed2D>()->speedX > 0.0)
+								{
+									entityManager->characters[j]->GetComponent<Speed2D>()->speedX = 0.0;
+								}
+							}
+						}
+					}
+					// PE AXA OY
+					else
+					{
+						if (entityManager->terrains[i]->GetComponent<Position2D>()->y < entityManager->characters[j]->GetComponent<Position2D>()->y)
+						{
+							entityManager->characters[j]->GetComponent<Position2D>()->y += entityManager->terrains[i]->GetComponent<Hitbox2D>()->height / 2 + entityManager->characters[j]->GetComponent<Hitbox2D>()->height / 2 - (entityManager->characters[j]->GetComponent<Position2D>()->y - entityManager->terrains[i]->GetComponent<Position2D>()->y);
+
+							entityManager->characters[j]->GetComponent<Hitbox2D>()->collidedDownward = true;
+
+							// UN COMPORTAMENT CARE ASTEAPTA UntilGrounded E RELUAT DE ArtificialIntelligenceManager
+							if (entityManager->characters[j]->HasComponent<ArtificialIntelligence2D>() && entityManager->characters[j]->GetComponent<ArtificialIntelligence2D>()->waitsForGround)
+							{
+								entityManager->characters[j]->GetComponent<ArtificialIntelligence2D>()->waitsForGround = false;
+
+								entityManager->groundedBehaviors.push_back(entityManager->characters[j]);
+							}
+
+							if (entityManager->characters[j]->HasComponent<Speed2D>())
+							{
+								if (entityManager->characters[j]->GetComponent<Speed2D>()->speedY < 0.0)
+								{
+									entityManager->characters[j]->GetComponent<Speed2D>()->speedY = 0.0;
+								}
+							}
+						}
+						else
+						{
+							entityManager->characters[j]->GetComponent<Position2D>()->y -= entityManager->terrains[i]->GetComponent<Hitbox2D>()->height / 2 + entityManager->characters[j]->GetComponent<Hitbox2D>()->height / 2 - (entityManager->terrains[i]->GetComponent<Position2D>()->y - entityManager->characters[j]->GetComponent<Position2D>()->y);
+
+							if (entityManager->characters[j]->HasComponent<Speed2D>())
+							{
+								if (entityManager->characters[j]->GetComponent<Speed2D>()->speedY > 0.0)
+								{
+									entityManager->characters[j]->GetComponent<Speed2D>()->speedY = 0.0;
+								}
 							}
 						}
 					}
+
+				}
+			}
+
+			for (int j = 0; j < entityManager->bullets.size(); j++)
+			{
+				if (!entityManager->bullets[j]->HasComponent<Position2D, Hitbox2D>()) continue;
+
+				aabbTests++;
+
+				if (std::max(entityManager->terrains[i]->GetComponent<Position2D>()->x - entityManager->terrains[i]->GetComponent<Hitbox2D>()->width / 2, entityManager->bullets[j]->GetComponent<Position2D>()->x - entityManager->bullets[j]->GetComponent<Hitbox2D>()->width / 2) <=
+					std::min(entityManager->terrains[i]->GetComponent<Position2D>()->x + entityManager->terrains[i]->GetComponent<Hitbox2D>()->width / 2, entityManager->bullets[j]->GetComponent<Position2D>()->x + entityManager->bullets[j]->GetComponent<Hitbox2D>()->width / 2) &&
+					std::max(entityManager->terrains[i]->GetComponent<Position2D>()->y - entityManager->terrains[i]->GetComponent<Hitbox2D>()->height / 2, entityManager->bullets[j]->GetComponent<Position2D>()->y - entityManager->bullets[j]->GetComponent<Hitbox2D>()->height / 2) <=
+					std::min(entityManager->terrains[i]->GetComponent<Position2D>()->y + entityManager->terrains[i]->GetComponent<Hitbox2D>()->height / 2, entityManager->bullets[j]->GetComponent<Position2D>()->y + entityManager->bullets[j]->GetComponent<Hitbox2D>()->height / 2))
+				{
+					entityManager->RemoveBullet(j);
+					j--;
+
+					bulletsRemoved++;
+				}
+			}
+		}
+
+		MetricsRegistry::Get()->Add(Metric::AABB_TESTS, aabbTests);
+		MetricsRegistry::Get()->Add(Metric::COLLISION_PUSHES, collisionPushes);
+		MetricsRegistry::Get()->Add(Metric::BULLETS_REMOVED, bulletsRemoved);
+	}
+
+private:
+
+	CollisionManager() {};
+
+	CollisionManager(const CollisionManager&) = delete;
+
+};
+
+// CLASA ANIMATION MANAGER
+
+// UN CADRU DINTR-O ANIMATIE: CE TEXTURA SE AFISEAZA SI CAT TIMP
+struct AnimationFrame
+{
+	unsigned int textureID = 0;
+	double duration = 0.1;
+};
+
+// UN SET DE ANIMATII (CATE UNA PENTRU FIECARE EntityAnimation), FOLOSIT IN COMUN DE TOATE ENTITATILE DE ACELASI FEL
+// CADRELE FIECAREI ANIMATII SUNT CONTINUE IN TABELUL frames DIN AnimationManager
+struct AnimationClipSet
+{
+	std::string name;
+
+	int clipStart[MAX_ANIMATIONS_ENTITY] = {};
+	int clipLength[MAX_ANIMATIONS_ENTITY] = {};
+};
+
+class AnimationManager
+{
+public:
+
+	static AnimationManager* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->animationManager == nullptr)
+		{
+			world->animationManager = new AnimationManager();
+		}
+
+		return world->animationManager;
+	}
+
+	int CreateClipSet(std::string name)
+	{
+		if (this->clipSetHandles.find(name) != this->clipSetHandles.end())
+		{
+			std::cout << "WARNING :: ANIMATION MANAGER :: CREATECLIPSET :: A CLIP SET NAMED \"" << name << "\" ALREADY EXISTS. RETURNING THE EXISTING ONE...\n";
+
+			return this->clipSetHandles[name];
+		}
+
+		AnimationClipSet clipSet;
+		clipSet.name = name;
+
+		this->clipSets.push_back(clipSet);
+		this->clipSetHandles.insert({ name, (int)this->clipSets.size() - 1 });
+
+		return (int)this->clipSets.size() - 1;
+	}
+
+	int GetClipSet(std::string name)
+	{
+		if (this->clipSetHandles.find(name) == this->clipSetHandles.end())
+		{
+			std::cout << "ERROR :: ANIMATION MANAGER :: GETCLIPSET :: COULD NOT FIND THE CLIP SET NAMED \"" << name << "\". RETURNING -1 INSTEAD...\n";
+
+			return -1;
+		}
+
+		return this->clipSetHandles[name];
+	}
+
+	// INLOCUIESTE ANIMATIA DATA DIN SET. CADRELE VECHI RAMAN NEFOLOSITE IN TABEL, DECI SE APELEAZA LA INCARCAREA NIVELULUI, NU IN TIMPUL JOCULUI
+	void SetClip(int clipSet, EntityAnimation entityAnimation, const std::vector<AnimationFrame>& clipFrames)
+	{
+		if (clipSet < 0 || clipSet >= this->clipSets.size() || entityAnimation == EntityAnimation::null)
+		{
+			std::cout << "ERROR :: ANIMATION MANAGER :: SETCLIP :: INVALID CLIP SET OR ANIMATION\n";
+
+			return;
+		}
+
+		this->clipSets[clipSet].clipStart[(int)entityAnimation] = (int)this->frames.size();
+		this->clipSets[clipSet].clipLength[(int)entityAnimation] = (int)clipFrames.size();
+
+		this->frames.insert(this->frames.end(), clipFrames.begin(), clipFrames.end());
+
+		// ENTITATILE CARE RULEAZA DEJA ANIMATIA INLOCUITA O IAU DE LA CAPAT (INDICELE VECHI POATE FI IN AFARA CLIPULUI NOU)
+		double currentTime = TimeManager::Get()->GetCurrentTime();
+
+		for (int i = 0; i < EntityManager::Get()->animatedEntities.size(); i++)
+		{
+			Entity* entity = EntityManager::Get()->animatedEntities[i];
+
+			if (!entity->HasComponent<Animation2D>())
+			{
+				continue;
+			}
+
+			Animation2D* animation = entity->GetComponent<Animation2D>();
+
+			if (animation->clipSet != clipSet || animation->currentEntityAnimation != entityAnimation)
+			{
+				continue;
+			}
+
+			animation->animationIndex = 0;
+
+			TimingWheel::Cancel(animation->frameTimer);
+			animation->frameTimer = nullptr;
+
+			if (!clipFrames.empty() && entity->HasComponent<Texture2D>())
+			{
+				this->SelectCurrentFrame(entity, animation, currentTime);
+			}
+		}
+	}
+
+	void SetClip(int clipSet, EntityAnimation entityAnimation, const std::vector<unsigned int>& textureIDs, double frameTime = 0.1)
+	{
+		std::vector<AnimationFrame> clipFrames(textureIDs.size());
+
+		for (int i = 0; i < textureIDs.size(); i++)
+		{
+			clipFrames[i].textureID = textureIDs[i];
+			clipFrames[i].duration = frameTime;
+		}
+
+		this->SetClip(clipSet, entityAnimation, clipFrames);
+	}
+
+	// COSTUL ESTE PROPORTIONAL CU NUMARUL DE SCHIMBARI DE CADRU SI DE STARE, NU CU NUMARUL DE ENTITATI ANIMATE
+	void UpdateAnimations()
+	{
+		double currentTime = TimeManager::Get()->GetCurrentTime();
+
+		this->firedEntities.clear();
+		this->frameTimers.Advance(currentTime, this->firedEntities);
+
+		long long frameFlips = 0;
+		long long stateChanges = 0;
+
+		for (int i = 0; i < this->firedEntities.size(); i++)
+		{
+			Entity* entity = this->firedEntities[i];
+
+			if (!entity->HasComponent<Animation2D>())
+			{
+				continue;
+			}
+
+			Animation2D* animation = entity->GetComponent<Animation2D>();
+			animation->frameTimer = nullptr; // NODUL A FOST DEJA RECICLAT DE ROATA
+
+			if (!entity->HasComponent<Texture2D>() || animation->currentEntityAnimation == EntityAnimation::null || animation->clipSet < 0 || animation->clipSet >= this->clipSets.size())
+			{
+				continue;
+			}
+
+			int clipLength = this->clipSets[animation->clipSet].clipLength[(int)animation->currentEntityAnimation];
+
+			if (clipLength == 0)
+			{
+				continue;
+			}
+
+			animation->animationIndex++;
+
+			if (animation->animationIndex >= clipLength)
+			{
+				animation->animationIndex = 0;
+			}
+
+			this->SelectCurrentFrame(entity, animation, currentTime);
+
+			frameFlips++;
+		}
+
+		for (int i = 0; i < EntityManager::Get()->animationStateChanges.size(); i++)
+		{
+			Entity* entity = EntityManager::Get()->animationStateChanges[i];
+
+			if (!entity->HasComponent<Animation2D>())
+			{
+				continue;
+			}
+
+			Animation2D* animation = entity->GetComponent<Animation2D>();
+			animation->stateChangeQueued = false;
+
+			if (!entity->HasComponent<Texture2D>() || !entity->HasComponent<Speed2D>() || animation->clipSet < 0 || animation->clipSet >= this->clipSets.size())
+			{
+				continue;
+			}
+
+			EntityAnimation entityAnimation = Animation2D::SelectEntityAnimation(entity->GetComponent<Speed2D>());
+
+			if (entityAnimation == animation->currentEntityAnimation)
+			{
+				continue;
+			}
+
+			animation->currentEntityAnimation = entityAnimation;
+			animation->animationIndex = 0;
+
+			stateChanges++;
+
+			TimingWheel::Cancel(animation->frameTimer);
+			animation->frameTimer = nullptr;
+
+			if (this->clipSets[animation->clipSet].clipLength[(int)entityAnimation] == 0)
+			{
+				continue;
+			}
+
+			this->SelectCurrentFrame(entity, animation, currentTime);
+
+			frameFlips++;
+		}
+
+		EntityManager::Get()->animationStateChanges.clear();
+
+		MetricsRegistry::Get()->Add(Metric::ANIMATION_FRAME_FLIPS, frameFlips);
+		MetricsRegistry::Get()->Add(Metric::ANIMATION_STATE_CHANGES, stateChanges);
+	}
+
+private:
+
+	std::vector<AnimationFrame> frames;
+	std::vector<AnimationClipSet> clipSets;
+	std::unordered_map<std::string, int> clipSetHandles;
+
+	TimingWheel frameTimers;
+	std::vector<Entity*> firedEntities;
+
+	// AFISEAZA CADRUL animationIndex SI PROGRAMEAZA URMATOAREA SCHIMBARE DUPA DURATA LUI
+	void SelectCurrentFrame(Entity* entity, Animation2D* animation, double currentTime)
+	{
+		const AnimationFrame& frame = this->frames[this->clipSets[animation->clipSet].clipStart[(int)animation->currentEntityAnimation] + animation->animationIndex];
+
+		entity->GetComponent<Texture2D>()->currentTextureID = frame.textureID;
+
+		animation->frameTimer = this->frameTimers.Schedule(entity, currentTime + frame.duration);
+	}
+
+	AnimationManager() {};
+
+	AnimationManager(const AnimationManager&) = delete;
+};
+
+// CLASA FLOW FIELD MANAGER
+
+// UN SINGUR CAMP DE DIRECTII SPRE JUCATOR, CALCULAT PE GRIDUL TERENULUI SI FOLOSIT DE TOATE ENTITATILE CU AI
+// COSTUL NU DEPINDE DE NUMARUL DE INAMICI: CAMPUL SE RECALCULEAZA DOAR CAND JUCATORUL SCHIMBA CELULA, IAR O ENTITATE FACE O SINGURA CITIRE
+// RECALCULAREA E IMPARTITA PE MAI MULTE CADRE (buildBudget CELULE PE CADRU), IAR PANA SE TERMINA ENTITATILE FOLOSESC CAMPUL ANTERIOR
+class FlowFieldManager
+{
+public:
+
+	static FlowFieldManager* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->flowFieldManager == nullptr)
+		{
+			world->flowFieldManager = new FlowFieldManager();
+		}
+
+		return world->flowFieldManager;
+	}
+
+	// cellSize IN PIXELI, maxJumpCells = CATE CELULE POATE URCA O ENTITATE DEASUPRA SOLULUI, maxFieldDistance = PANA UNDE SE PROPAGA CAMPUL (IN CELULE)
+	void SetParameters(double cellSize, int maxJumpCells, int maxFieldDistance)
+	{
+		this->cellSize = cellSize;
+		this->maxJumpCells = maxJumpCells;
+		this->maxFieldDistance = maxFieldDistance;
+
+		this->terrainDirty = true;
+	}
+
+	// CATE CELULE SUNT EXTINSE PE CADRU CAT TIMP SE CALCULEAZA CAMPUL NOU. 0 SAU NEGATIV = TOT CAMPUL INTR-UN CADRU
+	// CAND NU EXISTA UN CAMP ANTERIOR (LA INCEPUT, DUPA SCHIMBAREA TERENULUI) CAMPUL E CALCULAT MEREU INTR-UN SINGUR CADRU
+	void SetBuildBudget(int buildBudget)
+	{
+		this->buildBudget = buildBudget;
+	}
+
+	// TRUE CAT TIMP UN CAMP NOU E IN CALCUL (GetDirection FOLOSESTE INCA CAMPUL ANTERIOR)
+	bool IsBuilding()
+	{
+		return this->isBuilding;
+	}
+
+	// TERENUL E CONSIDERAT STATIC. SE APELEAZA DUPA CE SE MODIFICA TERENUL (NUMARUL DE TERENURI SE VERIFICA AUTOMAT)
+	void MarkTerrainDirty()
+	{
+		this->terrainDirty = true;
+	}
+
+	void UpdateFlowField()
+	{
+		if (this->terrainDirty || this->terrainCount != EntityManager::Get()->terrains.size())
+		{
+			this->BuildTerrainGrid();
+		}
+
+		if (Player::Get()->GetEntity() == nullptr || !Player::Get()->GetEntity()->HasComponent<Position2D>() || this->width == 0)
+		{
+			this->isValid = false;
+
+			return;
+		}
+
+		int playerCellX = this->GetCellX(Player::Get()->GetEntity()->GetComponent<Position2D>()->x);
+		int playerCellY = this->GetCellY(Player::Get()->GetEntity()->GetComponent<Position2D>()->y);
+
+		if (!this->IsInside(playerCellX, playerCellY))
+		{
+			this->isValid = false;
+
+			return;
+		}
+
+		// UN CALCUL INCEPUT NU E LUAT DE LA CAPAT CAND JUCATORUL MAI SCHIMBA O DATA CELULA (ALTFEL, CAT TIMP SE MISCA, NU S-AR TERMINA NICIODATA)
+		// DUPA CE SE TERMINA, URMATORUL PORNESTE DE LA CELULA DE ATUNCI A JUCATORULUI
+		if (!this->isBuilding && (!this->isValid || playerCellX != this->targetCellX || playerCellY != this->targetCellY))
+		{
+			this->StartFlowField(playerCellX, playerCellY);
+		}
+
+		if (this->isBuilding && this->ContinueFlowField(this->isValid ? this->buildBudget : 0))
+		{
+			std::swap(this->field, this->nextField);
+
+			this->targetCellX = this->buildTargetCellX;
+			this->targetCellY = this->buildTargetCellY;
+
+			this->isValid = true;
+		}
+	}
+
+	// DIRECTIA (FIECARE IN -1, 0, 1) IN CARE TREBUIE SA SE DEPLASEZE O ENTITATE DE LA (x, y) CA SA AJUNGA LA JUCATOR
+	// INTOARCE false DACA POZITIA E IN AFARA CAMPULUI SAU JUCATORUL NU POATE FI ATINS DE ACOLO
+	bool GetDirection(double x, double y, int& directionX, int& directionY)
+	{
+		if (!this->isValid)
+		{
+			return false;
+		}
+
+		int cellX = this->GetCellX(x);
+		int cellY = this->GetCellY(y);
+
+		if (!this->IsInside(cellX, cellY))
+		{
+			return false;
+		}
+
+		int cell = cellY * this->width + cellX;
+
+		if (this->field.generations[cell] != this->field.generation || this->field.directions[cell] == FlowFieldManager::NO_DIRECTION)
+		{
+			return false;
+		}
+
+		directionX = this->field.directions[cell] % 3 - 1;
+		directionY = this->field.directions[cell] / 3 - 1;
+
+		return true;
+	}
+
+	bool IsValid()
+	{
+		return this->isValid;
+	}
+
+private:
+
+	static const signed char NO_DIRECTION = -1;
+
+	// COSTURILE PASILOR (ALGORITMUL LUI DIAL, COSTURI INTREGI MICI). MERSUL PRIN AER E MAI SCUMP DECAT PE SOL, CA DRUMURILE SA URMEZE PLATFORMELE
+	static const int COST_HORIZONTAL = 2;
+	static const int COST_HORIZONTAL_AIR = 3;
+	static const int COST_DOWN = 1;
+	static const int COST_UP = 3;
+	static const int MAX_COST = 3;
+
+	double cellSize = 32.0;
+	int maxJumpCells = 4;
+	int maxFieldDistance = 256;
+
+	bool terrainDirty = true;
+	int terrainCount = -1;
+
+	double originX = 0.0;
+	double originY = 0.0;
+	int width = 0;
+	int height = 0;
+
+	std::vector<unsigned char> blocked;
+	std::vector<unsigned char> heightAboveGround; // CATE CELULE LIBERE SUNT INTRE CELULA SI SOLUL DE SUB EA (LIMITAT LA 255)
+
+	struct Field
+	{
+		std::vector<int> distances;
+		std::vector<int> generations; // CELULELE CU ALTA GENERATIE NU AU FOST ATINSE LA ULTIMUL CALCUL, ASA CA NU TREBUIE STERSE
+		std::vector<signed char> directions;
+		int generation = 0;
+
+		void Reset(int cellCount)
+		{
+			this->distances.assign(cellCount, 0);
+			this->generations.assign(cellCount, -1);
+			this->directions.assign(cellCount, (signed char)FlowFieldManager::NO_DIRECTION);
+			this->generation = 0;
+		}
+	};
+
+	Field field; // CEL FOLOSIT DE GetDirection
+	Field nextField; // CEL IN CALCUL, SCHIMBAT CU field CAND SE TERMINA
+
+	std::vector<std::vector<int>> buckets;
+
+	bool isValid = false;
+	int targetCellX = 0;
+	int targetCellY = 0;
+
+	// STAREA CALCULULUI IN CURS: COSTUL LA CARE S-A AJUNS, POZITIA IN GALEATA LUI SI CATE INTRARI MAI SUNT IN GALETI
+	int buildBudget = 4096;
+	bool isBuilding = false;
+	int buildTargetCellX = 0;
+	int buildTargetCellY = 0;
+	int buildCost = 0;
+	int buildIndex = 0;
+	int buildPending = 0;
+
+	int GetCellX(double x)
+	{
+		return (int)std::floor((x - this->originX) / this->cellSize);
+	}
+
+	int GetCellY(double y)
+	{
+		return (int)std::floor((y - this->originY) / this->cellSize);
+	}
+
+	bool IsInside(int cellX, int cellY)
+	{
+		return 0 <= cellX && cellX < this->width && 0 <= cellY && cellY < this->height;
+	}
+
+	void BuildTerrainGrid()
+	{
+		this->terrainDirty = false;
+		this->terrainCount = (int)EntityManager::Get()->terrains.size();
+		this->isValid = false;
+		this->isBuilding = false;
+
+		double minX = 0.0, minY = 0.0, maxX = 0.0, maxY = 0.0;
+		bool hasTerrain = false;
+
+		for (int i = 0; i < EntityManager::Get()->terrains.size(); i++)
+		{
+			Entity* terrain = EntityManager::Get()->terrains[i];
+
+			if (!terrain->HasComponent<Position2D>() || !terrain->HasComponent<Hitbox2D>())
+			{
+				continue;
+			}
+
+			Position2D* position = terrain->GetComponent<Position2D>();
+			Hitbox2D* hitbox = terrain->GetComponent<Hitbox2D>();
+
+			if (!hasTerrain)
+			{
+				minX = position->x - hitbox->width / 2.0;
+				maxX = position->x + hitbox->width / 2.0;
+				minY = position->y - hitbox->height / 2.0;
+				maxY = position->y + hitbox->height / 2.0;
+
+				hasTerrain = true;
+			}
+
+			minX = std::min(minX, position->x - hitbox->width / 2.0);
+			maxX = std::max(maxX, position->x + hitbox->width / 2.0);
+			minY = std::min(minY, position->y - hitbox->height / 2.0);
+			maxY = std::max(maxY, position->y + hitbox->height / 2.0);
+		}
+
+		if (!hasTerrain)
+		{
+			this->width = 0;
+			this->height = 0;
+
+			return;
+		}
+
+		// SPATIU LIBER DEASUPRA NIVELULUI, CA ENTITATILE CARE SAR SA RAMANA IN CAMP
+		maxY += this->cellSize * (this->maxJumpCells + 1);
+
+		this->originX = minX;
+		this->originY = minY;
+		this->width = (int)std::ceil((maxX - minX) / this->cellSize) + 1;
+		this->height = (int)std::ceil((maxY - minY) / this->cellSize) + 1;
+
+		int cellCount = this->width * this->height;
+
+		this->blocked.assign(cellCount, 0);
+		this->heightAboveGround.assign(cellCount, 255);
+		this->field.Reset(cellCount);
+		this->nextField.Reset(cellCount);
+
+		for (int i = 0; i < EntityManager::Get()->terrains.size(); i++)
+		{
+			Entity* terrain = EntityManager::Get()->terrains[i];
+
+			if (!terrain->HasComponent<Position2D>() || !terrain->HasComponent<Hitbox2D>())
+			{
+				continue;
+			}
+
+			Position2D* position = terrain->GetComponent<Position2D>();
+			Hitbox2D* hitbox = terrain->GetComponent<Hitbox2D>();
+
+			// O CELULA E BLOCATA DACA CENTRUL EI E ACOPERIT DE TEREN
+			int startX = std::max(0, (int)std::ceil((position->x - hitbox->width / 2.0 - this->originX) / this->cellSize - 0.5));
+			int endX = std::min(this->width - 1, (int)std::floor((position->x + hitbox->width / 2.0 - this->originX) / this->cellSize - 0.5));
+			int startY = std::max(0, (int)std::ceil((position->y - hitbox->height / 2.0 - this->originY) / this->cellSize - 0.5));
+			int endY = std::min(this->height - 1, (int)std::floor((position->y + hitbox->height / 2.0 - this->originY) / this->cellSize - 0.5));
+
+			for (int cellY = startY; cellY <= endY; cellY++)
+			{
+				for (int cellX = startX; cellX <= endX; cellX++)
+				{
+					this->blocked[cellY * this->width + cellX] = 1;
+				}
+			}
+		}
+
+		for (int cellX = 0; cellX < this->width; cellX++)
+		{
+			int freeCells = 255;
+
+			for (int cellY = 0; cellY < this->height; cellY++)
+			{
+				if (this->blocked[cellY * this->width + cellX])
+				{
+					freeCells = 0;
+				}
+				else
+				{
+					freeCells = std::min(freeCells + 1, 255);
+				}
+
+				this->heightAboveGround[cellY * this->width + cellX] = (unsigned char)freeCells;
+			}
+		}
+	}
+
+	// DIJKSTRA DE LA JUCATOR SPRE EXTERIOR (PE MUCHII INVERSATE), IN nextField. directions[v] ARATA SPRE CELULA URMATOARE DE PE DRUMUL LUI v SPRE JUCATOR
+	void StartFlowField(int cellX, int cellY)
+	{
+		this->nextField.generation++;
+
+		this->buckets.resize(FlowFieldManager::MAX_COST + 1);
+		for (int i = 0; i < this->buckets.size(); i++)
+		{
+			this->buckets[i].clear();
+		}
+
+		int target = cellY * this->width + cellX;
+
+		this->nextField.distances[target] = 0;
+		this->nextField.generations[target] = this->nextField.generation;
+		this->nextField.directions[target] = 4; // (0, 0)
+		this->buckets[0].push_back(target);
+
+		this->isBuilding = true;
+		this->buildTargetCellX = cellX;
+		this->buildTargetCellY = cellY;
+		this->buildCost = 0;
+		this->buildIndex = 0;
+		this->buildPending = 1;
+	}
+
+	// EXTINDE CEL MULT budget CELULE (0 SAU NEGATIV = FARA LIMITA) SI INTOARCE true DACA CAMPUL E GATA
+	// RELAXARILE AJUNG MEREU IN ALTA GALEATA DECAT CEA CURENTA (COSTURILE SUNT >= 1), DECI POZITIA IN GALEATA RAMANE VALABILA INTRE CADRE
+	bool ContinueFlowField(int budget)
+	{
+		int maxCost = this->maxFieldDistance * FlowFieldManager::COST_HORIZONTAL;
+		int expanded = 0;
+
+		for (; this->buildPending > 0 && this->buildCost <= maxCost; this->buildCost++)
+		{
+			int cost = this->buildCost;
+			std::vector<int>& bucket = this->buckets[cost % this->buckets.size()];
+
+			for (; this->buildIndex < bucket.size(); this->buildIndex++)
+			{
+				if (budget > 0 && expanded >= budget)
+				{
+					return false;
+				}
+
+				int cell = bucket[this->buildIndex];
+
+				if (this->nextField.distances[cell] != cost)
+				{
+					continue; // INTRARE VECHE, CELULA A FOST GASITA ULTERIOR PE UN DRUM MAI SCURT
+				}
+
+				expanded++;
+
+				int cellX = cell % this->width;
+				int cellY = cell / this->width;
+
+				// v ESTE VECINUL DIN CARE O ENTITATE AR AJUNGE IN cell
+				this->Relax(cellX - 1, cellY, cost + this->GetHorizontalCost(cellX - 1, cellY), 1, 0);
+				this->Relax(cellX + 1, cellY, cost + this->GetHorizontalCost(cellX + 1, cellY), -1, 0);
+				// DIN CELULA DE DEASUPRA SE AJUNGE IN cell CAZAND
+				this->Relax(cellX, cellY + 1, cost + FlowFieldManager::COST_DOWN, 0, -1);
+				// DIN CELULA DE DEDESUBT SE AJUNGE IN cell DOAR SARIND, DECI cell TREBUIE SA FIE APROAPE DE SOL
+				if (this->heightAboveGround[cell] <= this->maxJumpCells)
+				{
+					this->Relax(cellX, cellY - 1, cost + FlowFieldManager::COST_UP, 0, 1);
+				}
+			}
+
+			this->buildPending -= (int)bucket.size();
+			bucket.clear();
+			this->buildIndex = 0;
+		}
+
+		this->isBuilding = false;
+
+		return true;
+	}
+
+	int GetHorizontalCost(int cellX, int cellY)
+	{
+		if (this->IsInside(cellX, cellY) && this->heightAboveGround[cellY * this->width + cellX] == 1)
+		{
+			return FlowFieldManager::COST_HORIZONTAL;
+		}
+
+		return FlowFieldManager::COST_HORIZONTAL_AIR;
+	}
+
+	void Relax(int neighbourX, int neighbourY, int cost, int directionX, int directionY)
+	{
+		if (!this->IsInside(neighbourX, neighbourY))
+		{
+			return;
+		}
+
+		int neighbour = neighbourY * this->width + neighbourX;
+
+		if (this->blocked[neighbour])
+		{
+			return;
+		}
+
+		if (this->nextField.generations[neighbour] == this->nextField.generation && this->nextField.distances[neighbour] <= cost)
+		{
+			return;
+		}
+
+		this->nextField.generations[neighbour] = this->nextField.generation;
+		this->nextField.distances[neighbour] = cost;
+		this->nextField.directions[neighbour] = (signed char)((directionY + 1) * 3 + (directionX + 1));
+
+		this->buckets[cost % this->buckets.size()].push_back(neighbour);
+		this->buildPending++;
+	}
+
+	FlowFieldManager() {};
+
+	FlowFieldManager(const FlowFieldManager&) = delete;
+};
+
+// CLASA ARTIFICIAL INTELLIGENCE MANAGER
+
+// CE A FACUT PLANIFICATORUL DE AI IN ULTIMUL CADRU (TIMPII IN MILISECUNDE) SI DE CATE ORI NU A RAMAS IN BUGET
+struct ArtificialIntelligenceSchedulerStatistics
+{
+	int processedEntities = 0;
+	int pendingEntities = 0; // CATE AU RAMAS PENTRU CADRUL URMATOR
+
+	double usedTime = 0.0;
+
+	double averageWaitFrames = 0.0; // CAT AU ASTEPTAT ENTITATILE ACTUALIZATE IN ACEST CADRU
+	int maxWaitFrames = 0; // CEA MAI LUNGA ASTEPTARE DINTRE CELE RAMASE IN COADA
+	int starvedEntities = 0; // CATE ASTEAPTA DE CEL PUTIN starvationFrames CADRE
+
+	long long overBudgetFrames = 0;
+	long long starvedFrames = 0;
+};
+
+class ArtificialIntelligenceManager
+{
+public:
+
+	static ArtificialIntelligenceManager* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->artificialIntelligenceManager == nullptr)
+		{
+			world->artificialIntelligenceManager = new ArtificialIntelligenceManager();
+		}
+
+		return world->artificialIntelligenceManager;
+	}
+
+	// ENTITATILE APROAPE DE JUCATOR SUNT ACTUALIZATE IN FIECARE CADRU, CELE DIN BANDA MEDIE O DATA LA midRangeTickInterval CADRE,
+	// IAR CELE DEPARTE DORM (NU SUNT VIZITATE DELOC) PANA CAND JUCATORUL SE APROPIE SAU SUNT TREZITE CU WakeArtificialIntelligence
+	void UpdateArtificialIntelligence()
+	{
+		this->frameIndex++;
+
+		this->PlaceNewEntities();
+		this->RefreshGridPositions();
+
+#ifdef GAMEENGINE_COROUTINES
+		this->UpdateBehaviors();
+#endif
+
+		if (Player::Get()->GetEntity() == nullptr || !Player::Get()->GetEntity()->HasComponent<Position2D>()) // DACA EXISTA JUCATORUL
+		{
+			return;
+		}
+
+		Position2D* playerPosition = Player::Get()->GetEntity()->GetComponent<Position2D>();
+
+		FlowFieldManager::Get()->UpdateFlowField();
+
+		FrameAllocatorScope scratch;
+
+		FrameVector<Entity*> candidates;
+		EntityManager::Get()->artificialIntelligenceGrid.Query(playerPosition->x - this->midRangeDistance, playerPosition->y - this->midRangeDistance,
+			playerPosition->x + this->midRangeDistance, playerPosition->y + this->midRangeDistance, candidates);
+
+		for (int i = 0; i < candidates.size(); i++)
+		{
+			Entity* entity = candidates[i];
+
+			if (!this->CanUpdateEntity(entity))
+			{
+				continue;
+			}
+
+			ArtificialIntelligence2D* artificialIntelligence = entity->GetComponent<ArtificialIntelligence2D>();
+			Position2D* position = entity->GetComponent<Position2D>();
+
+			if (artificialIntelligence->HasBehavior())
+			{
+				EntityManager::Get()->artificialIntelligenceGrid.Remove(entity); // CONDUSA DE COMPORTAMENT, NU DE NIVELELE DE DETALIU
+
+				continue;
+			}
+
+			double distanceX = position->x - playerPosition->x;
+			double distanceY = position->y - playerPosition->y;
+			double distanceSquared = distanceX * distanceX + distanceY * distanceY;
+
+			if (distanceSquared > this->midRangeDistance * this->midRangeDistance)
+			{
+				continue;
+			}
+
+			if (artificialIntelligence->band == ArtificialIntelligenceBand::sleeping)
+			{
+				EntityManager::Get()->activeArtificialIntelligence.push_back(entity);
+			}
+
+			artificialIntelligence->lastSeenFrame = this->frameIndex;
+
+			artificialIntelligence->distanceToPlayer = std::sqrt(distanceSquared);
+
+			if (distanceSquared <= this->nearDistance * this->nearDistance)
+			{
+				artificialIntelligence->band = ArtificialIntelligenceBand::nearPlayer;
+
+				this->Enqueue(entity);
+			}
+			else
+			{
+				artificialIntelligence->band = ArtificialIntelligenceBand::midRange;
+
+				if ((this->frameIndex + artificialIntelligence->phase) % this->midRangeTickInterval == 0)
+				{
+					this->Enqueue(entity);
+				}
+			}
+		}
+
+		// ENTITATILE TREZITE EXPLICIT SUNT ACTUALIZATE CA SI CUM AR FI APROAPE, CHIAR DACA NU AU FOST GASITE IN GRID
+		std::vector<Entity*>& activeEntities = EntityManager::Get()->activeArtificialIntelligence;
+
+		for (int i = 0; i < activeEntities.size(); i++)
+		{
+			Entity* entity = activeEntities[i];
+			ArtificialIntelligence2D* artificialIntelligence = entity->GetComponent<ArtificialIntelligence2D>();
+
+			if (artificialIntelligence->lastSeenFrame == this->frameIndex)
+			{
+				continue;
+			}
+
+			if (artificialIntelligence->awakeUntilFrame >= this->frameIndex && this->CanUpdateEntity(entity))
+			{
+				artificialIntelligence->band = ArtificialIntelligenceBand::awake;
+				artificialIntelligence->lastSeenFrame = this->frameIndex;
+				artificialIntelligence->distanceToPlayer = std::sqrt((entity->GetComponent<Position2D>()->x - playerPosition->x) * (entity->GetComponent<Position2D>()->x - playerPosition->x) +
+					(entity->GetComponent<Position2D>()->y - playerPosition->y) * (entity->GetComponent<Position2D>()->y - playerPosition->y));
+
+				this->Enqueue(entity);
+
+				continue;
+			}
+
+			// A IESIT DIN RAZA: SE OPRESTE PE LOC SI ADOARME (DACA ERA IN ASTEPTARE, E SCOASA DIN COADA LA PROCESARE)
+			this->StopMoving(entity);
+			artificialIntelligence->band = ArtificialIntelligenceBand::sleeping;
+
+			activeEntities[i] = activeEntities[activeEntities.size() - 1];
+			activeEntities.pop_back();
+			i--;
+		}
+
+		this->ProcessPendingEntities(playerPosition);
+	}
+
+	// BUGETUL DE TIMP PE CADRU PENTRU ACTUALIZAREA ENTITATILOR CU AI (IN MILISECUNDE). 0 SAU NEGATIV = FARA LIMITA
+	void SetFrameBudget(double frameBudget)
+	{
+		this->frameBudget = frameBudget;
+	}
+
+	// starvationFrames = DUPA CATE CADRE DE ASTEPTARE O ENTITATE E CONSIDERATA INFOMETATA
+	// agingDistance = CU CATI PIXELI SE APROPIE PRIORITATEA UNEI ENTITATI DE JUCATOR PENTRU FIECARE CADRU ASTEPTAT
+	void SetStarvationParameters(int starvationFrames, double agingDistance)
+	{
+		this->starvationFrames = std::max(1, starvationFrames);
+		this->agingDistance = agingDistance;
+	}
+
+	// FOLOSIT LA REPLAY: IN LOC DE BUGETUL DE TIMP SE PROCESEAZA EXACT ATATEA ENTITATI (-1 = BUGETUL NORMAL)
+	void SetForcedUpdateCount(int forcedUpdateCount)
+	{
+		this->forcedUpdateCount = forcedUpdateCount;
+	}
+
+	const ArtificialIntelligenceSchedulerStatistics& GetSchedulerStatistics()
+	{
+		return this->statistics;
+	}
+
+	// UN PAS DIN LOGICA AGRESIVA OBISNUITA (FLOW FIELD SAU COMPARARE CU POZITIA JUCATORULUI), PENTRU COMPORTAMENTE
+	void StepTowardsPlayer(Entity* entity)
+	{
+		if (Player::Get()->GetEntity() == nullptr || !Player::Get()->GetEntity()->HasComponent<Position2D>() || !this->CanUpdateEntity(entity))
+		{
+			return;
+		}
+
+		this->UpdateEntity(entity, Player::Get()->GetEntity()->GetComponent<Position2D>());
+	}
+
+	void StopMoving(Entity* entity)
+	{
+		if (entity->HasComponent<Speed2D, MovementSpeed2D>())
+		{
+			this->StopEntity(entity);
+		}
+	}
+
+#ifdef GAMEENGINE_COROUTINES
+	// INLOCUIESTE LOGICA DE AI A ENTITATII CU UN COMPORTAMENT. ACESTA PORNESTE LA URMATORUL UPDATE
+	void SetBehavior(Entity* entity, ArtificialIntelligenceBehavior behavior)
+	{
+		if (!entity->HasComponent<ArtificialIntelligence2D>())
+		{
+			std::cout << "ERROR :: ARTIFICIAL INTELLIGENCE MANAGER :: SETBEHAVIOR :: ENTITY HAS NO ARTIFICIALINTELLIGENCE2D COMPONENT\n";
+
+			return;
+		}
+
+		ArtificialIntelligence2D* artificialIntelligence = entity->GetComponent<ArtificialIntelligence2D>();
+
+		TimingWheel::Cancel(artificialIntelligence->behaviorTimer);
+		artificialIntelligence->behaviorTimer = nullptr;
+		artificialIntelligence->waitsForGround = false;
+
+		artificialIntelligence->behavior = std::move(behavior);
+		artificialIntelligence->behavior.GetPromise().entity = entity;
+
+		// NU MAI E VIZITATA DE NIVELELE DE DETALIU SI DE PLANIFICATOR
+		EntityManager::Get()->artificialIntelligenceGrid.Remove(entity);
+		EntityManager::Get()->behaviorGrid.Remove(entity);
+
+		if (artificialIntelligence->band != ArtificialIntelligenceBand::sleeping)
+		{
+			std::vector<Entity*>& activeEntities = EntityManager::Get()->activeArtificialIntelligence;
+
+			for (int i = 0; i < activeEntities.size(); i++)
+			{
+				if (activeEntities[i] == entity)
+				{
+					activeEntities[i] = activeEntities[activeEntities.size() - 1];
+					activeEntities.pop_back();
+
+					break;
+				}
+			}
+
+			artificialIntelligence->band = ArtificialIntelligenceBand::sleeping;
+		}
+
+		EntityManager::Get()->behaviorsToResume.push_back(entity);
+	}
+
+	int GetSuspendedBehaviorCount()
+	{
+		return this->behaviorTimers.GetScheduledCount() + EntityManager::Get()->behaviorGrid.GetEntityCount();
+	}
+#endif
+
+	// TREZESTE O ENTITATE CARE DOARME (DE EXEMPLU CAND E LOVITA) PENTRU UN NUMAR DE CADRE
+	void WakeArtificialIntelligence(Entity* entity, int frameCount = 120)
+	{
+		if (!entity->HasComponent<ArtificialIntelligence2D>())
+		{
+			std::cout << "WARNING :: ARTIFICIAL INTELLIGENCE MANAGER :: WAKEARTIFICIALINTELLIGENCE :: ENTITY HAS NO ARTIFICIALINTELLIGENCE2D COMPONENT\n";
+
+			return;
+		}
+
+		if (!this->CanUpdateEntity(entity))
+		{
+			std::cout << "WARNING :: ARTIFICIAL INTELLIGENCE MANAGER :: WAKEARTIFICIALINTELLIGENCE :: ENTITY LACKS THE COMPONENTS NEEDED TO BE UPDATED\n";
+
+			return;
+		}
+
+		ArtificialIntelligence2D* artificialIntelligence = entity->GetComponent<ArtificialIntelligence2D>();
+
+		if (artificialIntelligence->HasBehavior())
+		{
+			return; // COMPORTAMENTELE SE TREZESC SINGURE, PRIN CONDITIILE PE CARE LE ASTEAPTA
+		}
+
+		if (artificialIntelligence->band == ArtificialIntelligenceBand::sleeping)
+		{
+			artificialIntelligence->band = ArtificialIntelligenceBand::awake;
+
+			EntityManager::Get()->activeArtificialIntelligence.push_back(entity);
+		}
+
+		artificialIntelligence->awakeUntilFrame = std::max(artificialIntelligence->awakeUntilFrame, this->frameIndex + frameCount);
+	}
+
+	// ENTITATILE MAI APROAPE DE nearDistance SUNT ACTUALIZATE IN FIECARE CADRU, CELE PANA LA midRangeDistance O DATA LA midRangeTickInterval CADRE
+	void SetLevelOfDetailBands(double nearDistance, double midRangeDistance, int midRangeTickInterval)
+	{
+		this->nearDistance = nearDistance;
+		this->midRangeDistance = std::max(nearDistance, midRangeDistance);
+		this->midRangeTickInterval = std::max(1, midRangeTickInterval);
+	}
+
+	// CATE CADRE POATE RAMANE NEACTUALIZATA POZITIA IN GRID A UNEI ENTITATI CARE DOARME (EA SE POATE MISCA DIN CAUZA FIZICII)
+	void SetGridRefreshInterval(int gridRefreshInterval)
+	{
+		this->gridRefreshInterval = std::max(1, gridRefreshInterval);
+	}
+
+	int GetActiveEntityCount()
+	{
+		return (int)EntityManager::Get()->activeArtificialIntelligence.size();
+	}
+
+private:
+
+	static const int BUDGET_CHECK_INTERVAL = 8;
+
+	double nearDistance = 800.0;
+	double midRangeDistance = 2000.0;
+	int midRangeTickInterval = 4;
+
+	int gridRefreshInterval = 30;
+	int gridRefreshCursor = 0;
+
+	int nextPhase = 0;
+
+	long long frameIndex = 0;
+
+	double frameBudget = 1.5;
+	int starvationFrames = 30;
+	double agingDistance = 50.0;
+	int forcedUpdateCount = -1;
+
+	ArtificialIntelligenceSchedulerStatistics statistics;
+
+#ifdef GAMEENGINE_COROUTINES
+	TimingWheel behaviorTimers;
+	std::vector<Entity*> firedBehaviors;
+
+	double maxBehaviorRadius = 0.0; // CEA MAI MARE RAZA CERUTA DE UN UntilPlayerWithin, CA SA STIM CAT DE LARG SA CAUTAM IN GRID
+
+	// RELUARE DOAR PENTRU COMPORTAMENTELE A CAROR CONDITIE S-A INDEPLINIT. CELELALTE NU SUNT VIZITATE
+	void UpdateBehaviors()
+	{
+		std::vector<Entity*>& toResume = EntityManager::Get()->behaviorsToResume;
+
+		this->firedBehaviors.clear();
+		this->behaviorTimers.Advance(TimeManager::Get()->GetCurrentTime(), this->firedBehaviors);
+
+		for (int i = 0; i < this->firedBehaviors.size(); i++)
+		{
+			if (this->firedBehaviors[i]->HasComponent<ArtificialIntelligence2D>())
+			{
+				this->firedBehaviors[i]->GetComponent<ArtificialIntelligence2D>()->behaviorTimer = nullptr;
+
+				toResume.push_back(this->firedBehaviors[i]);
+			}
+		}
+
+		toResume.insert(toResume.end(), EntityManager::Get()->groundedBehaviors.begin(), EntityManager::Get()->groundedBehaviors.end());
+		EntityManager::Get()->groundedBehaviors.clear();
+
+		if (EntityManager::Get()->behaviorGrid.GetEntityCount() > 0 && Player::Get()->GetEntity() != nullptr && Player::Get()->GetEntity()->HasComponent<Position2D>())
+		{
+			Position2D* playerPosition = Player::Get()->GetEntity()->GetComponent<Position2D>();
+
+			FrameAllocatorScope scratch;
+
+			FrameVector<Entity*> candidates;
+			EntityManager::Get()->behaviorGrid.Query(playerPosition->x - this->maxBehaviorRadius, playerPosition->y - this->maxBehaviorRadius,
+				playerPosition->x + this->maxBehaviorRadius, playerPosition->y + this->maxBehaviorRadius, candidates);
+
+			for (int i = 0; i < candidates.size(); i++)
+			{
+				Entity* entity = candidates[i];
+
+				if (!entity->HasComponent<ArtificialIntelligence2D>() || !entity->HasComponent<Position2D>() || !entity->GetComponent<ArtificialIntelligence2D>()->HasBehavior())
+				{
+					EntityManager::Get()->behaviorGrid.Remove(entity);
+
+					continue;
+				}
+
+				double radius = entity->GetComponent<ArtificialIntelligence2D>()->behavior.GetPromise().radius;
+				double distanceX = entity->GetComponent<Position2D>()->x - playerPosition->x;
+				double distanceY = entity->GetComponent<Position2D>()->y - playerPosition->y;
+
+				if (distanceX * distanceX + distanceY * distanceY <= radius * radius)
+				{
+					EntityManager::Get()->behaviorGrid.Remove(entity);
+
+					toResume.push_back(entity);
+				}
+			}
+		}
+
+		// UN COMPORTAMENT RELUAT POATE ADAUGA IN LISTA (DE EXEMPLU PRIN SetBehavior PE ALTA ENTITATE), DECI SE LUCREAZA PE O COPIE
+		this->resuming.swap(toResume);
+		toResume.clear();
+
+		for (int i = 0; i < this->resuming.size(); i++)
+		{
+			this->ResumeBehavior(this->resuming[i]);
+		}
+
+		this->resuming.clear();
+	}
+
+	std::vector<Entity*> resuming;
+
+	void ResumeBehavior(Entity* entity)
+	{
+		if (!entity->HasComponent<ArtificialIntelligence2D>())
+		{
+			return;
+		}
+
+		ArtificialIntelligence2D* artificialIntelligence = entity->GetComponent<ArtificialIntelligence2D>();
+
+		if (!artificialIntelligence->HasBehavior() || artificialIntelligence->behavior.IsDone())
+		{
+			return;
+		}
+
+		artificialIntelligence->behavior.Resume();
+
+		if (artificialIntelligence->behavior.IsDone())
+		{
+			// COMPORTAMENTUL S-A TERMINAT: ENTITATEA REVINE LA LOGICA OBISNUITA
+			artificialIntelligence->behavior.Destroy();
+
+			EntityManager::Get()->artificialIntelligenceToPlace.push_back(entity);
+
+			return;
+		}
+
+		ArtificialIntelligenceBehavior::promise_type& promise = artificialIntelligence->behavior.GetPromise();
+
+		if (promise.wait == BehaviorWait::time)
+		{
+			artificialIntelligence->behaviorTimer = this->behaviorTimers.Schedule(entity, promise.wakeTime);
+		}
+		else if (promise.wait == BehaviorWait::playerWithin)
+		{
+			this->maxBehaviorRadius = std::max(this->maxBehaviorRadius, promise.radius);
+
+			if (entity->HasComponent<Position2D>())
+			{
+				EntityManager::Get()->behaviorGrid.Update(entity, entity->GetComponent<Position2D>()->x, entity->GetComponent<Position2D>()->y);
+			}
+		}
+		else if (promise.wait == BehaviorWait::grounded)
+		{
+			artificialIntelligence->waitsForGround = true;
+		}
+	}
+#endif
+
+	void Enqueue(Entity* entity)
+	{
+		ArtificialIntelligence2D* artificialIntelligence = entity->GetComponent<ArtificialIntelligence2D>();
+
+		if (artificialIntelligence->isPending)
+		{
+			return; // E DEJA IN COADA DIN CADRELE ANTERIOARE, CEREREA SE UNESTE CU CEA EXISTENTA
+		}
+
+		artificialIntelligence->isPending = true;
+		artificialIntelligence->pendingSinceFrame = this->frameIndex;
+
+		EntityManager::Get()->pendingArtificialIntelligence.push_back(entity);
+	}
+
+	double GetPriority(ArtificialIntelligence2D* artificialIntelligence)
+	{
+		return artificialIntelligence->distanceToPlayer - this->agingDistance * (this->frameIndex - artificialIntelligence->pendingSinceFrame);
+	}
+
+	// ACTUALIZEAZA ENTITATILE DIN COADA IN ORDINEA PRIORITATII (CELE APROPIATE INTAI, CELE CARE ASTEAPTA DE MULT URCA IN FATA)
+	// PANA SE TERMINA BUGETUL. CE RAMANE SE REIA IN CADRUL URMATOR
+	void ProcessPendingEntities(Position2D* playerPosition)
+	{
+		std::vector<Entity*>& pending = EntityManager::Get()->pendingArtificialIntelligence;
+
+		for (int i = 0; i < pending.size(); i++)
+		{
+			if (!this->CanUpdateEntity(pending[i]) || pending[i]->GetComponent<ArtificialIntelligence2D>()->band == ArtificialIntelligenceBand::sleeping
+				|| pending[i]->GetComponent<ArtificialIntelligence2D>()->HasBehavior())
+			{
+				if (pending[i]->HasComponent<ArtificialIntelligence2D>())
+				{
+					pending[i]->GetComponent<ArtificialIntelligence2D>()->isPending = false;
+				}
+
+				pending[i] = pending[pending.size() - 1];
+				pending.pop_back();
+				i--;
+			}
+		}
+
+		std::sort(pending.begin(), pending.end(), [this](Entity* first, Entity* second)
+			{
+				ArtificialIntelligence2D* firstArtificialIntelligence = first->GetComponent<ArtificialIntelligence2D>();
+				ArtificialIntelligence2D* secondArtificialIntelligence = second->GetComponent<ArtificialIntelligence2D>();
+
+				double firstPriority = this->GetPriority(firstArtificialIntelligence);
+				double secondPriority = this->GetPriority(secondArtificialIntelligence);
+
+				if (firstPriority != secondPriority)
+				{
+					return firstPriority < secondPriority;
+				}
+
+				return firstArtificialIntelligence->phase < secondArtificialIntelligence->phase;
+			});
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		int processed = 0;
+		long long totalWait = 0;
+		double elapsed = 0.0;
+
+		while (processed < pending.size())
+		{
+			if (this->forcedUpdateCount >= 0)
+			{
+				if (processed >= this->forcedUpdateCount)
+				{
+					break;
+				}
+			}
+			else if (this->frameBudget > 0.0 && processed > 0 && processed % ArtificialIntelligenceManager::BUDGET_CHECK_INTERVAL == 0)
+			{
+				// CEASUL E CITIT DOAR O DATA LA CATEVA ENTITATI. MACAR O ENTITATE E ACTUALIZATA IN FIECARE CADRU
+				elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+				if (elapsed >= this->frameBudget)
+				{
+					break;
+				}
+			}
+
+			Entity* entity = pending[processed];
+			ArtificialIntelligence2D* artificialIntelligence = entity->GetComponent<ArtificialIntelligence2D>();
+
+			totalWait += this->frameIndex - artificialIntelligence->pendingSinceFrame;
+			artificialIntelligence->isPending = false;
+
+			this->UpdateEntity(entity, playerPosition);
+
+			processed++;
+		}
+
+		pending.erase(pending.begin(), pending.begin() + processed);
+
+		this->statistics.processedEntities = processed;
+		this->statistics.pendingEntities = (int)pending.size();
+		this->statistics.usedTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		this->statistics.averageWaitFrames = processed > 0 ? (double)totalWait / processed : 0.0;
+		this->statistics.maxWaitFrames = 0;
+		this->statistics.starvedEntities = 0;
+
+		for (int i = 0; i < pending.size(); i++)
+		{
+			long long wait = this->frameIndex - pending[i]->GetComponent<ArtificialIntelligence2D>()->pendingSinceFrame;
+
+			this->statistics.maxWaitFrames = std::max(this->statistics.maxWaitFrames, (int)wait);
+
+			if (wait >= this->starvationFrames)
+			{
+				this->statistics.starvedEntities++;
+			}
+		}
+
+		if (this->statistics.starvedEntities > 0)
+		{
+			this->statistics.starvedFrames++;
+		}
+		if (!pending.empty())
+		{
+			this->statistics.overBudgetFrames++;
+		}
+	}
+
+	bool CanUpdateEntity(Entity* entity)
+	{
+		return entity->HasComponent<Position2D, Speed2D, MovementSpeed2D, ArtificialIntelligence2D, Hitbox2D>();
+	}
+
+	void PlaceNewEntities()
+	{
+		std::vector<Entity*>& toPlace = EntityManager::Get()->artificialIntelligenceToPlace;
+
+		for (int i = 0; i < toPlace.size(); i++)
+		{
+			if (toPlace[i]->HasComponent<ArtificialIntelligence2D>() && toPlace[i]->GetComponent<ArtificialIntelligence2D>()->HasBehavior())
+			{
+				toPlace[i] = toPlace[toPlace.size() - 1];
+				toPlace.pop_back();
+				i--;
+
+				continue; // CONDUSA DE COMPORTAMENT, NU INTRA IN GRIDUL LOGICII OBISNUITE
+			}
+
+			if (!toPlace[i]->HasComponent<Position2D>())
+			{
+				continue; // RAMANE IN LISTA PANA PRIMESTE O POZITIE
+			}
+
+			EntityManager::Get()->artificialIntelligenceGrid.Update(toPlace[i], toPlace[i]->GetComponent<Position2D>()->x, toPlace[i]->GetComponent<Position2D>()->y);
+
+			if (toPlace[i]->HasComponent<ArtificialIntelligence2D>())
+			{
+				toPlace[i]->GetComponent<ArtificialIntelligence2D>()->phase = this->nextPhase++;
+			}
+
+			toPlace[i] = toPlace[toPlace.size() - 1];
+			toPlace.pop_back();
+			i--;
+		}
+	}
+
+	// RECALCULEAZA CELULA PENTRU O PARTE DIN ENTITATI IN FIECARE CADRU, ASTFEL INCAT TOATE SUNT ACTUALIZATE O DATA LA gridRefreshInterval CADRE
+	void RefreshGridPositions()
+	{
+		std::vector<Entity*>& entities = EntityManager::Get()->artificalIntelligence;
+
+		if (entities.empty())
+		{
+			return;
+		}
+
+		int count = ((int)entities.size() + this->gridRefreshInterval - 1) / this->gridRefreshInterval;
+
+		for (int i = 0; i < count; i++)
+		{
+			if (this->gridRefreshCursor >= entities.size())
+			{
+				this->gridRefreshCursor = 0;
+			}
+
+			Entity* entity = entities[this->gridRefreshCursor++];
+
+			if (entity->HasComponent<Position2D>() && EntityManager::Get()->artificialIntelligenceGrid.Contains(entity))
+			{
+				EntityManager::Get()->artificialIntelligenceGrid.Update(entity, entity->GetComponent<Position2D>()->x, entity->GetComponent<Position2D>()->y);
+			}
+		}
+	}
+
+	void StopEntity(Entity* entity)
+	{
+		MovementSpeed2D* movementSpeed = entity->GetComponent<MovementSpeed2D>();
+		Speed2D* speed = entity->GetComponent<Speed2D>();
+
+		if (movementSpeed->wentRight)
+		{
+			movementSpeed->wentRight = false;
+
+			speed->speedX -= movementSpeed->speedX;
+		}
+
+		if (movementSpeed->wentLeft)
+		{
+			movementSpeed->wentLeft = false;
+
+			speed->speedX += movementSpeed->speedX;
+		}
+	}
+
+	void UpdateEntity(Entity* entity, Position2D* playerPosition)
+	{
+		ArtificialIntelligence2D* artificialIntelligence = entity->GetComponent<ArtificialIntelligence2D>();
+		MovementSpeed2D* movementSpeed = entity->GetComponent<MovementSpeed2D>();
+		Position2D* position = entity->GetComponent<Position2D>();
+		Speed2D* speed = entity->GetComponent<Speed2D>();
+		Hitbox2D* hitbox = entity->GetComponent<Hitbox2D>();
+
+		artificialIntelligence->lastTickFrame = this->frameIndex;
+
+		this->StopEntity(entity);
+
+		// DACA ENTITATEA ESTE AGRESIVA FATA DE JUCATOR
+		if (artificialIntelligence->state == ArtificialIntelligence::aggresive)
+		{
+			int directionX = 0;
+			int directionY = 0;
+
+			bool closeToPlayer = std::abs(playerPosition->x - position->x) <= AI::EPSILON_X_AGGRESIVE && std::abs(playerPosition->y - position->y) <= AI::EPSILON_Y_AGGRESIVE;
+
+			// DRUMUL PRIN TEREN DIN FLOW FIELD. DACA ENTITATEA E IN AFARA CAMPULUI SE FOLOSESTE COMPARAREA DIRECTA CU POZITIA JUCATORULUI
+			if (!closeToPlayer && FlowFieldManager::Get()->GetDirection(position->x, position->y, directionX, directionY))
+			{
+				// CAMPUL SPUNE SA CADA, DAR ENTITATEA STA PE MARGINEA UNEI PLATFORME (HITBOX-UL E MAI LAT DECAT CELULA). O IA SPRE JUCATOR CA SA COBOARE
+				if (directionX == 0 && directionY < 0 && hitbox->collidedDownward)
+				{
+					directionX = playerPosition->x < position->x ? -1 : 1;
+				}
+
+				if (directionX < 0)
+				{
+					speed->speedX -= movementSpeed->speedX;
+
+					movementSpeed->wentLeft = true;
+				}
+				else if (directionX > 0)
+				{
+					speed->speedX += movementSpeed->speedX;
+
+					movementSpeed->wentRight = true;
+				}
+
+				if (directionY > 0 && hitbox->collidedDownward)
+				{
+					hitbox->collidedDownward = false;
+
+					speed->speedY += movementSpeed->speedY;
 				}
 			}
+			else
+			{
+				this->SteerTowardsPlayer(position, playerPosition, speed, movementSpeed, hitbox);
+			}
+		}
+
+		// PRIN StepTowardsPlayer AJUNG AICI SI ENTITATILE CU COMPORTAMENT, CARE NU TREBUIE PUSE INAPOI IN GRIDUL NIVELELOR DE DETALIU
+		if (!artificialIntelligence->HasBehavior())
+		{
+			EntityManager::Get()->artificialIntelligenceGrid.Update(entity, position->x, position->y);
+		}
+	}
+
+	void SteerTowardsPlayer(Position2D* position, Position2D* playerPosition, Speed2D* speed, MovementSpeed2D* movementSpeed, Hitbox2D* hitbox)
+	{
+		if (playerPosition->x < position->x - AI::EPSILON_X_AGGRESIVE)
+		{
+			speed->speedX -= movementSpeed->speedX;
+
+			movementSpeed->wentLeft = true;
+
+			if (hitbox->collidedDownward)
+			{
+				hitbox->collidedDownward = false;
+
+				speed->speedY += movementSpeed->speedY;
+			}
+		}
+
+		if (playerPosition->x > position->x + AI::EPSILON_X_AGGRESIVE)
+		{
+			speed->speedX += movementSpeed->speedX;
+
+			movementSpeed->wentRight = true;
+
+			if (hitbox->collidedDownward)
+			{
+				hitbox->collidedDownward = false;
+
+				speed->speedY += movementSpeed->speedY;
+			}
+		}
+
+		if (hitbox->collidedDownward && playerPosition->y > position->y + AI::EPSILON_Y_AGGRESIVE)
+		{
+			hitbox->collidedDownward = false;
+
+			speed->speedY += movementSpeed->speedY;
+		}
+	}
+
+	ArtificialIntelligenceManager() {};
+
+	ArtificialIntelligenceManager(const ArtificialIntelligenceManager&) = delete;
+};
+
+// CLASA REPLAY MANAGER
+
+// UN CADRU INREGISTRAT: CAT A DURAT, CE TASTE ERAU APASATE SI CATE ENTITATI CU AI AU INCAPUT IN BUGETUL DE TIMP
+// (FARA ULTIMUL, REZULTATUL UNUI REPLAY AR DEPINDE DE VITEZA MASINII PE CARE RULEAZA)
+struct ReplayFrame
+{
+	double deltaTime = 0.0;
+	unsigned char keyState = 0;
+	std::uint32_t artificialIntelligenceUpdates = 0;
+};
+
+// STATISTICI PENTRU O RULARE DE REPLAY (TIMPII SUNT IN MILISECUNDE, MASURATI DOAR PE SIMULARE)
+struct ReplayStatistics
+{
+	int frameCount = 0;
+
+	double simulatedTime = 0.0; // SECUNDE DE JOC SIMULATE
+	double totalFrameTime = 0.0;
+
+	double minFrameTime = 0.0;
+	double maxFrameTime = 0.0;
+	double averageFrameTime = 0.0;
+	double percentile50FrameTime = 0.0;
+	double percentile95FrameTime = 0.0;
+	double percentile99FrameTime = 0.0;
+
+	std::uint64_t checksum = 0;
+	std::uint64_t expectedChecksum = 0;
+	bool hasExpectedChecksum = false;
+	bool checksumMatches = false;
+};
+
+class ReplayManager
+{
+public:
+
+	static ReplayManager* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->replayManager == nullptr)
+		{
+			world->replayManager = new ReplayManager();
+		}
+
+		return world->replayManager;
+	}
+
+	void StartRecording(std::string address)
+	{
+		this->recordingAddress = address;
+		this->recordedFrames.clear();
+		this->recordingStartTime = TimeManager::Get()->GetCurrentTime();
+
+		this->isRecording = true;
+	}
+
+	void RecordFrame(double deltaTime, unsigned char keyState, int artificialIntelligenceUpdates)
+	{
+		if (!this->isRecording)
+		{
+			return;
+		}
+
+		ReplayFrame frame;
+		frame.deltaTime = deltaTime;
+		frame.keyState = keyState;
+		frame.artificialIntelligenceUpdates = (std::uint32_t)artificialIntelligenceUpdates;
+
+		this->recordedFrames.push_back(frame);
+	}
+
+	// SCRIE FISIERUL. CHECKSUM-UL STARII FINALE E SALVAT LA SFARSIT CA REPLAY-UL SA POATA FI VERIFICAT
+	void StopRecording()
+	{
+		if (!this->isRecording)
+		{
+			std::cout << "WARNING :: REPLAY MANAGER :: STOPRECORDING :: THERE IS NO RECORDING IN PROGRESS\n";
+
+			return;
+		}
+
+		this->isRecording = false;
+
+		std::ofstream fileOutput(this->recordingAddress, std::ios::binary);
+
+		if (!fileOutput)
+		{
+			std::cout << "ERROR :: REPLAY MANAGER :: STOPRECORDING :: COULD NOT OPEN THE FILE AT THE ADDRESS \"" << this->recordingAddress << "\" FOR WRITING\n";
+
+			return;
+		}
+
+		std::uint32_t magic = ReplayManager::MAGIC;
+		std::uint32_t version = ReplayManager::VERSION;
+		std::uint32_t frameCount = (std::uint32_t)this->recordedFrames.size();
+		std::uint64_t checksum = this->ComputeSimulationChecksum();
+
+		fileOutput.write((const char*)&magic, sizeof(magic));
+		fileOutput.write((const char*)&version, sizeof(version));
+		fileOutput.write((const char*)&frameCount, sizeof(frameCount));
+		fileOutput.write((const char*)&this->recordingStartTime, sizeof(this->recordingStartTime));
+
+		for (int i = 0; i < this->recordedFrames.size(); i++)
+		{
+			fileOutput.write((const char*)&this->recordedFrames[i].deltaTime, sizeof(double));
+			fileOutput.write((const char*)&this->recordedFrames[i].keyState, sizeof(unsigned char));
+			fileOutput.write((const char*)&this->recordedFrames[i].artificialIntelligenceUpdates, sizeof(std::uint32_t));
+		}
+
+		fileOutput.write((const char*)&checksum, sizeof(checksum));
+
+		this->recordedFrames.clear();
+	}
+
+	bool IsRecording()
+	{
+		return this->isRecording;
+	}
+
+	bool LoadReplay(std::string address, std::vector<ReplayFrame>& frames, double& startTime, std::uint64_t& checksum, bool& hasChecksum)
+	{
+		std::ifstream fileInput(address, std::ios::binary);
+
+		if (!fileInput)
+		{
+			std::cout << "ERROR :: REPLAY MANAGER :: LOADREPLAY :: COULD NOT FIND ANY FILE AT THE ADDRESS \"" << address << "\"\n";
+
+			return false;
+		}
+
+		std::uint32_t magic = 0;
+		std::uint32_t version = 0;
+		std::uint32_t frameCount = 0;
+
+		fileInput.read((char*)&magic, sizeof(magic));
+		fileInput.read((char*)&version, sizeof(version));
+		fileInput.read((char*)&frameCount, sizeof(frameCount));
+		fileInput.read((char*)&startTime, sizeof(startTime));
+
+		if (!fileInput || magic != ReplayManager::MAGIC || version != ReplayManager::VERSION)
+		{
+			std::cout << "ERROR :: REPLAY MANAGER :: LOADREPLAY :: THE FILE AT THE ADDRESS \"" << address << "\" IS NOT A VALID REPLAY\n";
+
+			return false;
+		}
+
+		frames.resize(frameCount);
+
+		for (int i = 0; i < frames.size(); i++)
+		{
+			fileInput.read((char*)&frames[i].deltaTime, sizeof(double));
+			fileInput.read((char*)&frames[i].keyState, sizeof(unsigned char));
+			fileInput.read((char*)&frames[i].artificialIntelligenceUpdates, sizeof(std::uint32_t));
+		}
+
+		if (!fileInput)
+		{
+			std::cout << "ERROR :: REPLAY MANAGER :: LOADREPLAY :: THE FILE AT THE ADDRESS \"" << address << "\" IS TRUNCATED\n";
+
+			return false;
+		}
+
+		hasChecksum = (bool)fileInput.read((char*)&checksum, sizeof(checksum));
+
+		return true;
+	}
+
+	// HASH FNV-1A PESTE POZITIILE SI VITEZELE TUTUROR ENTITATILOR. DOUA SIMULARI IDENTICE DAU ACELASI REZULTAT
+	std::uint64_t ComputeSimulationChecksum()
+	{
+		std::uint64_t hash = 14695981039346656037ULL;
+
+		this->HashEntities(hash, EntityManager::Get()->characters);
+		this->HashEntities(hash, EntityManager::Get()->terrains);
+		this->HashEntities(hash, EntityManager::Get()->bullets);
+
+		return hash;
+	}
+
+	void ComputeFrameTimeStatistics(std::vector<double>& frameTimes, ReplayStatistics& statistics)
+	{
+		statistics.frameCount = (int)frameTimes.size();
+
+		if (frameTimes.empty())
+		{
+			return;
+		}
+
+		std::sort(frameTimes.begin(), frameTimes.end());
+
+		statistics.totalFrameTime = 0.0;
+		for (int i = 0; i < frameTimes.size(); i++)
+		{
+			statistics.totalFrameTime += frameTimes[i];
+		}
+
+		statistics.minFrameTime = frameTimes[0];
+		statistics.maxFrameTime = frameTimes[frameTimes.size() - 1];
+		statistics.averageFrameTime = statistics.totalFrameTime / frameTimes.size();
+		statistics.percentile50FrameTime = frameTimes[(frameTimes.size() - 1) * 50 / 100];
+		statistics.percentile95FrameTime = frameTimes[(frameTimes.size() - 1) * 95 / 100];
+		statistics.percentile99FrameTime = frameTimes[(frameTimes.size() - 1) * 99 / 100];
+	}
+
+	void PrintStatistics(const ReplayStatistics& statistics)
+	{
+		std::cout << "REPLAY :: FRAMES " << statistics.frameCount << " :: SIMULATED " << statistics.simulatedTime << " S :: TOTAL " << statistics.totalFrameTime << " MS\n";
+		std::cout << "REPLAY :: FRAME TIME (MS) :: MIN " << statistics.minFrameTime << " :: AVG " << statistics.averageFrameTime << " :: P50 " << statistics.percentile50FrameTime
+			<< " :: P95 " << statistics.percentile95FrameTime << " :: P99 " << statistics.percentile99FrameTime << " :: MAX " << statistics.maxFrameTime << "\n";
+
+		if (statistics.hasExpectedChecksum)
+		{
+			std::cout << "REPLAY :: CHECKSUM " << (statistics.checksumMatches ? "MATCHES" : "DOES NOT MATCH") << " THE RECORDED SESSION\n";
+		}
+	}
+
+private:
+
+	static const std::uint32_t MAGIC = 0x50524547; // "GERP"
+	static const std::uint32_t VERSION = 2;
+
+	bool isRecording;
+
+	std::string recordingAddress;
+	double recordingStartTime;
+
+	std::vector<ReplayFrame> recordedFrames;
+
+	void HashBytes(std::uint64_t& hash, const void* data, int size)
+	{
+		for (int i = 0; i < size; i++)
+		{
+			hash ^= ((const unsigned char*)data)[i];
+			hash *= 1099511628211ULL;
+		}
+	}
+
+	void HashEntities(std::uint64_t& hash, const std::vector<Entity*>& entities)
+	{
+		for (int i = 0; i < entities.size(); i++)
+		{
+			if (entities[i]->HasComponent<Position2D>())
+			{
+				this->HashBytes(hash, &entities[i]->GetComponent<Position2D>()->x, sizeof(Scalar));
+				this->HashBytes(hash, &entities[i]->GetComponent<Position2D>()->y, sizeof(Scalar));
+			}
+			if (entities[i]->HasComponent<Speed2D>())
+			{
+				this->HashBytes(hash, &entities[i]->GetComponent<Speed2D>()->speedX, sizeof(Scalar));
+				this->HashBytes(hash, &entities[i]->GetComponent<Speed2D>()->speedY, sizeof(Scalar));
+			}
+		}
+	}
+
+	ReplayManager()
+	{
+		this->isRecording = false;
+
+		this->recordingStartTime = 0.0;
+	}
+
+	ReplayManager(const ReplayManager&) = delete;
+};
+
+// CLASA SNAPSHOT MANAGER
+
+// STAREA SALVATA A UNEI LUMI: COMPONENTELE TRIVIAL COPIABILE, STOCARE CU STOCARE, PLUS CEASUL
+// BUFFER-UL SE PASTREAZA INTRE CAPTURI, DECI DUPA PRIMA CAPTURA NU SE MAI ALOCA NIMIC CAT TIMP NUMARUL DE COMPONENTE NU CRESTE
+struct WorldSnapshot
+{
+	std::vector<unsigned char> data;
+
+	std::vector<int> typeIDs;
+	std::vector<int> counts;
+	std::vector<std::uint64_t> versions;
+
+	double currentTime = 0.0;
+	double deltaTime = 0.0;
+
+	long long tick = -1;
+	bool isValid = false;
+	bool hasUnsavedComponents = false; // EXISTAU COMPONENTE CARE NU SUNT TRIVIAL COPIABILE, DECI CAPTURA NU POATE FI RESTAURATA
+};
+
+// SALVEAZA SI RESTAUREAZA STAREA SIMULARII (PENTRU ROLLBACK SI PENTRU AI CARE INCEARCA VARIANTE IN AVANS)
+// O RESTAURARE MERGE DOAR DACA DE LA CAPTURA NU S-AU ADAUGAT SAU STERS COMPONENTE. COMPONENTELE CARE NU SUNT TRIVIAL COPIABILE
+// (Animation2D, ArtificialIntelligence2D) TIN STARE IN AFARA STOCARII (EVENIMENTE PROGRAMATE, CORUTINE, PLANIFICATORUL DE AI) CARE NU E SALVATA,
+// DECI CAT TIMP EXISTA ASTFEL DE COMPONENTE RESTAURAREA E REFUZATA, CA SA NU AMESTECE STARE VECHE CU STARE NOUA
+class SnapshotManager
+{
+public:
+
+	static SnapshotManager* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->snapshotManager == nullptr)
+		{
+			world->snapshotManager = new SnapshotManager();
+		}
+
+		return world->snapshotManager;
+	}
+
+	void Capture(WorldSnapshot& snapshot)
+	{
+		snapshot.typeIDs.clear();
+		snapshot.counts.clear();
+		snapshot.versions.clear();
+
+		snapshot.hasUnsavedComponents = this->HasUnsavedComponents();
+
+		std::size_t size = 0;
+
+		for (int i = 0; i < MAX_COMPONENTS; i++)
+		{
+			ComponentStorage& storage = ComponentStorageManager::Get()->GetStorage(i);
+
+			if (!storage.IsInitialized() || !storage.GetTypeInfo().isTriviallyCopyable)
+			{
+				continue;
+			}
+
+			snapshot.typeIDs.push_back(i);
+			snapshot.counts.push_back(storage.GetCount());
+			snapshot.versions.push_back(storage.GetVersion());
+
+			size += (std::size_t)storage.GetCount() * storage.GetTypeInfo().size;
+		}
+
+		snapshot.data.resize(size);
+
+		std::size_t offset = 0;
+
+		for (int i = 0; i < snapshot.typeIDs.size(); i++)
+		{
+			ComponentStorage& storage = ComponentStorageManager::Get()->GetStorage(snapshot.typeIDs[i]);
+
+			for (int first = 0; first < snapshot.counts[i]; first += ComponentStorage::CHUNK_SIZE)
+			{
+				std::size_t bytes = (std::size_t)std::min(ComponentStorage::CHUNK_SIZE, snapshot.counts[i] - first) * storage.GetTypeInfo().size;
+
+				std::memcpy(snapshot.data.data() + offset, storage.GetChunk(first >> ComponentStorage::CHUNK_SHIFT), bytes);
+				offset += bytes;
+			}
+		}
+
+		snapshot.currentTime = TimeManager::Get()->GetCurrentTime();
+		snapshot.deltaTime = TimeManager::Get()->GetDeltaTime();
+
+		snapshot.isValid = true;
+	}
+
+	bool Restore(const WorldSnapshot& snapshot)
+	{
+		if (!snapshot.isValid)
+		{
+			std::cout << "ERROR :: SNAPSHOT MANAGER :: RESTORE :: THE SNAPSHOT HAS NOT BEEN CAPTURED\n";
+
+			return false;
+		}
+
+		if (snapshot.hasUnsavedComponents || this->HasUnsavedComponents())
+		{
+			std::cout << "ERROR :: SNAPSHOT MANAGER :: RESTORE :: THE WORLD HAS COMPONENTS THAT ARE NOT TRIVIALLY COPYABLE (ANIMATION2D, ARTIFICIALINTELLIGENCE2D), WHOSE STATE IS NOT PART OF THE SNAPSHOT\n";
+
+			return false;
+		}
+
+		std::bitset<MAX_COMPONENTS> savedStorages;
+
+		for (int i = 0; i < snapshot.typeIDs.size(); i++)
+		{
+			ComponentStorage& storage = ComponentStorageManager::Get()->GetStorage(snapshot.typeIDs[i]);
+
+			if (storage.GetVersion() != snapshot.versions[i])
+			{
+				std::cout << "ERROR :: SNAPSHOT MANAGER :: RESTORE :: COMPONENTS WERE ADDED OR REMOVED SINCE THE SNAPSHOT WAS CAPTURED\n";
+
+				return false;
+			}
+
+			savedStorages.set(snapshot.typeIDs[i]);
+		}
+
+		// UN TIP DE COMPONENTA FOLOSIT PRIMA DATA DUPA CAPTURA NU E IN EA, DECI COMPONENTELE LUI AR RAMANE CU VALORILE DE ACUM
+		for (int i = 0; i < MAX_COMPONENTS; i++)
+		{
+			ComponentStorage& storage = ComponentStorageManager::Get()->GetStorage(i);
+
+			if (storage.IsInitialized() && storage.GetCount() > 0 && !savedStorages.test(i))
+			{
+				std::cout << "ERROR :: SNAPSHOT MANAGER :: RESTORE :: COMPONENTS WERE ADDED OR REMOVED SINCE THE SNAPSHOT WAS CAPTURED\n";
+
+				return false;
+			}
+		}
+
+		std::size_t offset = 0;
+
+		for (int i = 0; i < snapshot.typeIDs.size(); i++)
+		{
+			ComponentStorage& storage = ComponentStorageManager::Get()->GetStorage(snapshot.typeIDs[i]);
+
+			for (int first = 0; first < snapshot.counts[i]; first += ComponentStorage::CHUNK_SIZE)
+			{
+				std::size_t bytes = (std::size_t)std::min(ComponentStorage::CHUNK_SIZE, snapshot.counts[i] - first) * storage.GetTypeInfo().size;
+
+				std::memcpy(storage.GetChunk(first >> ComponentStorage::CHUNK_SHIFT), snapshot.data.data() + offset, bytes);
+				offset += bytes;
+			}
+		}
+
+		this->RefreshSpatialStructures();
+
+		TimeManager::Get()->SetCurrentTime(snapshot.currentTime - snapshot.deltaTime);
+		TimeManager::Get()->SetDeltaTime(snapshot.deltaTime);
+
+		return true;
+	}
+
+	// CATE CADRE PASTREAZA ISTORICUL (0 = FARA ISTORIC). CAND E ACTIVAT, GameEngine::UpdateSystems SALVEAZA STAREA LA SFARSITUL FIECARUI CADRU
+	void SetHistoryLength(int historyLength)
+	{
+		this->history.clear();
+		this->history.resize(std::max(0, historyLength));
+	}
+
+	int GetHistoryLength()
+	{
+		return (int)this->history.size();
+	}
+
+	void RecordTick()
+	{
+		if (this->history.empty())
+		{
+			return;
+		}
+
+		this->currentTick++;
+
+		WorldSnapshot& snapshot = this->history[this->currentTick % this->history.size()];
+
+		this->Capture(snapshot);
+		snapshot.tick = this->currentTick;
+	}
+
+	// READUCE LUMEA IN STAREA DE LA SFARSITUL CADRULUI tick (DACA E INCA IN ISTORIC). CADRELE DE DUPA EL SUNT SCOASE DIN ISTORIC
+	bool Rollback(long long tick)
+	{
+		if (this->history.empty() || tick < 0 || tick > this->currentTick)
+		{
+			return false;
+		}
+
+		WorldSnapshot& snapshot = this->history[tick % this->history.size()];
+
+		if (snapshot.tick != tick || !this->Restore(snapshot))
+		{
+			return false;
+		}
+
+		for (long long i = tick + 1; i <= this->currentTick && i - tick <= (long long)this->history.size(); i++)
+		{
+			this->history[i % this->history.size()].tick = -1;
+		}
+
+		this->currentTick = tick;
+
+		return true;
+	}
+
+	long long GetCurrentTick()
+	{
+		return this->currentTick;
+	}
+
+private:
+
+	std::vector<WorldSnapshot> history;
+
+	long long currentTick = -1;
+
+	bool HasUnsavedComponents()
+	{
+		for (int i = 0; i < MAX_COMPONENTS; i++)
+		{
+			ComponentStorage& storage = ComponentStorageManager::Get()->GetStorage(i);
+
+			if (storage.IsInitialized() && !storage.GetTypeInfo().isTriviallyCopyable && storage.GetCount() > 0)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// POZITIILE RESTAURATE TREBUIE SA AJUNGA SI IN GRIDURILE AI-ULUI SI IN CAMPUL DE DIRECTII (CA LA GameEngine::RebaseOrigin)
+	void RefreshSpatialStructures()
+	{
+		EntityManager* entityManager = EntityManager::Get();
+
+		for (int i = 0; i < entityManager->artificalIntelligence.size(); i++)
+		{
+			Entity* entity = entityManager->artificalIntelligence[i];
+
+			if (!entity->HasComponent<Position2D>())
+			{
+				continue;
+			}
+
+			if (entityManager->artificialIntelligenceGrid.Contains(entity))
+			{
+				entityManager->artificialIntelligenceGrid.Update(entity, entity->GetComponent<Position2D>()->x, entity->GetComponent<Position2D>()->y);
+			}
+			if (entityManager->behaviorGrid.Contains(entity))
+			{
+				entityManager->behaviorGrid.Update(entity, entity->GetComponent<Position2D>()->x, entity->GetComponent<Position2D>()->y);
+			}
+		}
+
+		FlowFieldManager::Get()->MarkTerrainDirty();
+	}
+
+	SnapshotManager() {};
+
+	SnapshotManager(const SnapshotManager&) = delete;
+};
+
+inline bool SpatialOrderManager::HasSnapshotHistory()
+{
+	return World::GetCurrent()->snapshotManager != nullptr && SnapshotManager::Get()->GetHistoryLength() > 0;
+}
+
+// CLASA GAME ENGINE
+
+class GameEngine
+{
+public:
+
+	static GameEngine* Get()
+	{
+		World* world = World::GetCurrent();
+
+		if (world->gameEngine == nullptr)
+		{
+			world->gameEngine = new GameEngine();
+		}
+
+		return world->gameEngine;
+	}
+
+	void Start(int windowWidth, int windowHeight, std::string gameTitle)
+	{
+		WindowManager::Get()->CreateWindow(windowWidth, windowHeight, gameTitle);
+
+		// CEASUL GLFW E COMUN TUTUROR LUMILOR, DECI E REPORNIT DOAR AICI, NU LA CREAREA FIECARUI TimeManager
+		glfwSetTime(0.0);
+		TimeManager::Get();
+
+		//AssetManager::Get();
+	}
+
+	void Update()
+	{
+		// SPRITE-URILE TRIMISE DE LA Update-UL TRECUT SUNT DESENATE INAINTE DE SCHIMBAREA BUFFERELOR
+		{
+			PerformanceCounterScope scope(EngineSystem::render);
+			RenderQueue::Get()->Flush();
+		}
+
+		WindowManager::Get()->UpdateWindow();
+		TimeManager::Get()->UpdateDeltaTime();
+
+		this->UpdateSystems();
+
+		ReplayManager::Get()->RecordFrame(TimeManager::Get()->GetDeltaTime(), UserInputManager::Get()->GetKeyState(), ArtificialIntelligenceManager::Get()->GetSchedulerStatistics().processedEntities);
+
+		if (UserInputManager::Get()->ShouldGameEngineStop())
+		{
+			this->isRunning = false;
+		}
+
+		FrameAllocator::Get()->Reset();
+
+		this->EndMetricsFrame(TimeManager::Get()->GetDeltaTime() * 1000000.0);
+	}
+
+	// PARTEA DE SIMULARE DIN UPDATE, FARA FEREASTRA SI CEAS. INPUT-UL E CONSUMAT AICI, CHIAR INAINTE DE MISCARE, CA SA PRINDA SI EVENIMENTELE VENITE IN TIMPUL CADRULUI
+	void UpdateSystems()
+	{
+		{
+			PerformanceCounterScope scope(EngineSystem::input);
+			UserInputManager::Get()->ListenForInput();
+		}
+
+		{
+			PerformanceCounterScope scope(EngineSystem::movement);
+			MovementManager::Get()->UpdateMovements();
+		}
+		{
+			PerformanceCounterScope scope(EngineSystem::collision);
+			CollisionManager::Get()->UpdateCollisions();
+		}
+
+		{
+			PerformanceCounterScope scope(EngineSystem::animation);
+			AnimationManager::Get()->UpdateAnimations();
+		}
+
+		{
+			PerformanceCounterScope scope(EngineSystem::artificialIntelligence);
+			ArtificialIntelligenceManager::Get()->UpdateArtificialIntelligence();
+		}
+
+		if (this->rebaseDistance > 0.0 && Player::Get()->GetEntity() != nullptr && Player::Get()->GetEntity()->HasComponent<Position2D>())
+		{
+			Scalar playerX = Player::Get()->GetEntity()->GetComponent<Position2D>()->x;
+			Scalar playerY = Player::Get()->GetEntity()->GetComponent<Position2D>()->y;
+
+			if (std::abs(playerX) > this->rebaseDistance || std::abs(playerY) > this->rebaseDistance)
+			{
+				// DEPLASARE CU UN NUMAR INTREG, CA POZITIILE SA FIE MUTATE EXACT, FARA ERORI DE ROTUNJIRE
+				this->RebaseOrigin(std::round(playerX), std::round(playerY));
+			}
+		}
+
+		{
+			PerformanceCounterScope scope(EngineSystem::camera);
+			CameraManager::Get()->UpdateCameras(TimeManager::Get()->GetDeltaTime());
+		}
+
+		{
+			PerformanceCounterScope scope(EngineSystem::spatialOrder);
+			SpatialOrderManager::Get()->Update();
+		}
+
+		{
+			PerformanceCounterScope scope(EngineSystem::snapshot);
+			SnapshotManager::Get()->RecordTick();
 		}
 	}
 
-private:
+	// MUTA ORIGINEA LUMII IN PUNCTUL (offsetX, offsetY) AL SISTEMULUI CURENT. ENTITATILE DIN EntityManager SUNT DEPLASATE CU -offset,
+	// GRIDURILE SI CAMPUL DE DIRECTII AL AI-ULUI SUNT ACTUALIZATE, CAMERELE SUNT MUTATE ODATA CU LUMEA. FUNDALURILE Parallax2D FOLOSESC ORIGINEA, DECI NU SAR
+	void RebaseOrigin(Scalar offsetX, Scalar offsetY)
+	{
+		this->MoveEntities(EntityManager::Get()->characters, offsetX, offsetY);
+		this->MoveEntities(EntityManager::Get()->terrains, offsetX, offsetY);
+		this->MoveEntities(EntityManager::Get()->bullets, offsetX, offsetY);
+		this->MoveEntities(EntityManager::Get()->landScapes, offsetX, offsetY);
 
-	static ArtificialIntelligenceManager* instance;
+		for (int i = 0; i < EntityManager::Get()->artificalIntelligence.size(); i++)
+		{
+			Entity* entity = EntityManager::Get()->artificalIntelligence[i];
 
-	ArtificialIntelligenceManager() {};
+			if (!entity->HasComponent<Position2D>())
+			{
+				continue;
+			}
 
-	ArtificialIntelligenceManager(const ArtificialIntelligenceManager&) = delete;
-};
+			if (EntityManager::Get()->artificialIntelligenceGrid.Contains(entity))
+			{
+				EntityManager::Get()->artificialIntelligenceGrid.Update(entity, entity->GetComponent<Position2D>()->x, entity->GetComponent<Position2D>()->y);
+			}
+			if (EntityManager::Get()->behaviorGrid.Contains(entity))
+			{
+				EntityManager::Get()->behaviorGrid.Update(entity, entity->GetComponent<Position2D>()->x, entity->GetComponent<Position2D>()->y);
+			}
+		}
 
-ArtificialIntelligenceManager* ArtificialIntelligenceManager::instance = nullptr;
+		FlowFieldManager::Get()->MarkTerrainDirty();
 
-// CLASA GAME ENGINE
+		CameraManager::Get()->MoveCameras(-offsetX, -offsetY);
 
-class GameEngine
-{
-public:
+		this->originX += offsetX;
+		this->originY += offsetY;
+	}
 
-	static GameEngine* Get()
+	// CAND JUCATORUL SE INDEPARTEAZA LA MAI MULT DE distance DE ORIGINE PE ORICARE AXA, ORIGINEA E MUTATA IN POZITIA LUI. 0 DEZACTIVEAZA
+	void SetAutomaticRebasing(Scalar distance)
 	{
-		if (GameEngine::instance == nullptr)
-		{
-			GameEngine::instance = new GameEngine();
-		}
-
-		return GameEngine::instance;
+		this->rebaseDistance = distance;
 	}
 
-	void Start(int windowWidth, int windowHeight, std::string gameTitle)
+	// POZITIA ORIGINII CURENTE IN COORDONATELE INITIALE ALE LUMII (POZITIA ABSOLUTA = ORIGINE + Position2D)
+	double GetOriginX()
 	{
-		WindowManager::Get()->CreateWindow(windowWidth, windowHeight, gameTitle);
-		TimeManager::Get();
+		return this->originX;
+	}
 
-		//AssetManager::Get();
+	double GetOriginY()
+	{
+		return this->originY;
 	}
 
-	void Update()
+	// RULEAZA UN REPLAY FARA FEREASTRA. NIVELUL TREBUIE SA FIE CONSTRUIT LA FEL CA LA INREGISTRARE INAINTE DE APEL
+	ReplayStatistics Replay(std::string address)
 	{
-		WindowManager::Get()->UpdateWindow();
-		TimeManager::Get()->UpdateDeltaTime();
-		UserInputManager::Get()->ListenForInput();
+		ReplayStatistics statistics;
 
-		MovementManager::Get()->UpdateMovements();
-		CollisionManager::Get()->UpdateCollisions();
+		std::vector<ReplayFrame> frames;
+		double startTime = 0.0;
 
-		AnimationManager::Get()->UpdateAnimations();
+		if (!ReplayManager::Get()->LoadReplay(address, frames, startTime, statistics.expectedChecksum, statistics.hasExpectedChecksum))
+		{
+			return statistics;
+		}
 
-		ArtificialIntelligenceManager::Get()->UpdateArtificialIntelligence();
+		std::vector<double> frameTimes;
+		frameTimes.reserve(frames.size());
 
-		if (UserInputManager::Get()->ShouldGameEngineStop())
+		// CEASUL JOCULUI E PUS LA LOC LA SFARSIT, ALTFEL URMATORUL UpdateDeltaTime AR CALCULA O DIFERENTA FATA DE CEASUL REPLAY-ULUI
+		TimeManager::State timeState = TimeManager::Get()->GetState();
+
+		TimeManager::Get()->SetCurrentTime(startTime);
+		UserInputManager::Get()->SetUsesExternalKeyState(true);
+
+		for (int i = 0; i < frames.size(); i++)
 		{
-			this->isRunning = false;
+			std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+
+			TimeManager::Get()->SetDeltaTime(frames[i].deltaTime);
+			UserInputManager::Get()->SetKeyState(frames[i].keyState);
+
+			ArtificialIntelligenceManager::Get()->SetForcedUpdateCount(frames[i].artificialIntelligenceUpdates);
+
+			this->UpdateSystems();
+
+			frameTimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+
+			statistics.simulatedTime += frames[i].deltaTime;
+
+			FrameAllocator::Get()->Reset();
+
+			this->EndMetricsFrame(frameTimes.back() * 1000.0);
 		}
+
+		UserInputManager::Get()->SetUsesExternalKeyState(false);
+		ArtificialIntelligenceManager::Get()->SetForcedUpdateCount(-1);
+
+		TimeManager::Get()->SetState(timeState);
+
+		ReplayManager::Get()->ComputeFrameTimeStatistics(frameTimes, statistics);
+
+		statistics.checksum = ReplayManager::Get()->ComputeSimulationChecksum();
+		statistics.checksumMatches = statistics.hasExpectedChecksum && statistics.checksum == statistics.expectedChecksum;
+
+		return statistics;
 	}
 
 	void Stop()
@@ -1884,16 +9785,430 @@ public:
 
 private:
 
-	static GameEngine* instance;
-
 	bool isRunning;
 
+	double originX;
+	double originY;
+
+	Scalar rebaseDistance;
+
+	// VALORILE LUMII IMPLICITE (VEZI namespace Metric), APOI INCHIDE CADRUL IN MetricsRegistry
+	void EndMetricsFrame(double frameTimeMicroseconds)
+	{
+		MetricsRegistry* metrics = MetricsRegistry::Get();
+
+		if (World::GetCurrent() == World::GetDefault())
+		{
+			EntityManager* entityManager = EntityManager::Get();
+
+			metrics->Set(Metric::CHARACTER_COUNT, (double)entityManager->characters.size());
+			metrics->Set(Metric::TERRAIN_COUNT, (double)entityManager->terrains.size());
+			metrics->Set(Metric::BULLET_COUNT, (double)entityManager->bullets.size());
+			metrics->Set(Metric::LANDSCAPE_COUNT, (double)entityManager->landScapes.size());
+			metrics->Set(Metric::ANIMATED_ENTITY_COUNT, (double)entityManager->animatedEntities.size());
+			metrics->Set(Metric::ARTIFICIAL_INTELLIGENCE_COUNT, (double)entityManager->artificalIntelligence.size());
+			metrics->Set(Metric::ACTIVE_ARTIFICIAL_INTELLIGENCE_COUNT, (double)entityManager->activeArtificialIntelligence.size());
+			metrics->Set(Metric::FRAME_ALLOCATOR_BYTES, (double)FrameAllocator::Get()->GetLastFramePeakBytes());
+		}
+
+		metrics->Record(Metric::FRAME_TIME, frameTimeMicroseconds);
+
+		metrics->EndFrame();
+	}
+
+	void MoveEntities(std::vector<Entity*>& entities, Scalar offsetX, Scalar offsetY)
+	{
+		for (int i = 0; i < entities.size(); i++)
+		{
+			if (entities[i]->HasComponent<Position2D>())
+			{
+				entities[i]->GetComponent<Position2D>()->x -= offsetX;
+				entities[i]->GetComponent<Position2D>()->y -= offsetY;
+			}
+		}
+	}
+
 	GameEngine()
 	{
 		this->isRunning = true;
+
+		this->originX = 0.0;
+		this->originY = 0.0;
+
+		this->rebaseDistance = 0.0;
 	}
 
 	GameEngine(const GameEngine&) = delete;
 };
 
-GameEngine* GameEngine::instance = nullptr;
\ No newline at end of file
+inline void Parallax2D::Render(Renderer2D* renderer2D)
+{
+	if (!entity->HasComponent<Texture2D>())
+	{
+		std::cout << "ERROR :: PARALLAX2DCOMPONENT :: THERE IS NO TEXTURE2D COMPONENT FOR ENTITY. RETURNING WITHOUT RENDERING...\n";
+
+		return;
+	}
+
+	if (entity->GetComponent<Texture2D>()->currentTextureID == 0)
+	{
+		std::cout << "WARNING :: PARALLAX2DCOMPONENT :: THERE IS NO TEXTURE TO USE FOR RENDERING. SELECTING THE ERROR TEXTURE INSTEAD AND ATTEMPTING RENDERING...\n";
+
+		entity->GetComponent<Texture2D>()->currentTextureID = AssetManager::Get()->GetErrorTextureID();
+	}
+
+	// DERULAREA FOLOSESTE POZITIA ABSOLUTA A CAMEREI, CA FUNDALUL SA NU SARA CAND ORIGINEA LUMII E MUTATA
+	double scrollBaseX = GameEngine::Get()->GetOriginX() * this->factorX + TimeManager::Get()->GetCurrentTime() * this->scrollSpeedX;
+	double scrollBaseY = GameEngine::Get()->GetOriginY() * this->factorY + TimeManager::Get()->GetCurrentTime() * this->scrollSpeedY;
+
+	RenderQueue::Get()->SubmitBackground(renderer2D, entity->GetComponent<Texture2D>()->currentTextureID, this->layer, this->depth, entity,
+		this->tileWidth, this->tileHeight, this->factorX, this->factorY, scrollBaseX, scrollBaseY);
+}
+
+// DESTRUCTORUL LUMII, DUPA CE TOATE SISTEMELE SUNT DEFINITE
+
+inline World::~World()
+{
+	WorldScope scope(this);
+
+	// ENTITATILE INTAI, CAT TIMP SISTEMELE DIN CARE SE SCOT INCA EXISTA
+	if (this->entityManager != nullptr)
+	{
+		this->entityManager->DeleteAllEntities();
+	}
+
+	// COMPONENTELE RAMASE POT TINE EVENIMENTE IN ROTILE SISTEMELOR SI CADRE DE CORUTINE, DECI SE DISTRUG INAINTEA LOR
+	delete this->componentStorageManager;
+	delete this->entityPool;
+
+	delete this->gameEngine;
+	delete this->renderQueue;
+	delete this->cameraManager;
+	delete this->spatialOrderManager;
+	delete this->snapshotManager;
+	delete this->replayManager;
+	delete this->artificialIntelligenceManager;
+	delete this->flowFieldManager;
+	delete this->animationManager;
+	delete this->collisionManager;
+	delete this->movementManager;
+	delete this->userInputManager;
+	delete this->entityManager;
+	delete this->player;
+	delete this->timeManager;
+#ifdef GAMEENGINE_COROUTINES
+	delete this->behaviorFramePool;
+#endif
+}
+
+// CLASA BATCH RUNNER
+
+// UN SCENARIU DE SIMULAT DE MAI MULTE ORI: NIVELUL (CONSTRUIT DE buildLevel IN LUMEA CURENTA), INPUT-UL SCRIPTAT SI CATE CADRE
+struct BatchScenario
+{
+	std::function<void(int simulationIndex)> buildLevel; // CREEAZA ENTITATILE, JUCATORUL SI COMPORTAMENTELE AI
+	std::vector<InputEvent> inputScript; // TIMPII SUNT IN SECUNDE DE SIMULARE
+
+	int frameCount = 600;
+	double deltaTime = 1.0 / 60.0;
+
+	// FARA BUGET DE TIMP PENTRU AI, CA REZULTATUL SA NU DEPINDA DE CAT DE INCARCATA E MASINA (buildLevel POATE SCHIMBA BUGETUL)
+	bool deterministic = true;
+
+	// OPTIONAL: SE OPRESTE DUPA CADRUL IN CARE INTOARCE true
+	std::function<bool(int simulationIndex)> shouldStop;
+	// OPTIONAL: ADAUGA VALORI PROPRII IN result.values (MEDIATE IN RAPORT), APELAT INAINTE CA LUMEA SA FIE STEARSA
+	std::function<void(int simulationIndex, std::vector<double>& values)> collectValues;
+};
+
+struct BatchSimulationResult
+{
+	int simulationIndex = 0;
+	int threadIndex = 0;
+
+	int frameCount = 0;
+	double simulatedTime = 0.0; // SECUNDE
+	double wallTime = 0.0; // MILISECUNDE
+
+	std::uint64_t checksum = 0;
+	std::size_t arenaBytes = 0;
+
+	std::vector<double> values;
+
+	// GOL DACA SIMULAREA A MERS PANA LA CAPAT. ALTFEL MESAJUL EXCEPTIEI ARUNCATE (DE buildLevel SAU IN TIMPUL CADRELOR)
+	std::string error;
+};
+
+struct BatchReport
+{
+	int simulationCount = 0;
+	int threadCount = 0;
+
+	int failedSimulations = 0; // CELE CU error, LASATE DEOPARTE LA SUME, MEDII SI SUME DE CONTROL
+
+	long long totalFrames = 0;
+	double totalSimulatedTime = 0.0; // SECUNDE
+	double wallTime = 0.0; // SECUNDE, PENTRU TOT LOTUL
+
+	double framesPerSecond = 0.0; // CADRE SIMULATE PE SECUNDA REALA, ADUNATE PE TOATE FIRELE
+	double simulationsPerSecond = 0.0;
+
+	double averageSimulationTime = 0.0; // MILISECUNDE
+	double maxSimulationTime = 0.0;
+
+	int distinctChecksums = 0;
+	std::vector<double> averageValues;
+
+	HardwareCounterReport hardwareCounters; // ADUNATE DE PE TOATE FIRELE, DOAR CU PerformanceCounters ACTIVAT
+
+	std::vector<BatchSimulationResult> results;
+};
+
+// RULEAZA MULTE SIMULARI FARA FEREASTRA, FIECARE IN LUMEA EI, PE UN GRUP DE FIRE CARE ISI IAU SIMULARILE DINTR-UN CONTOR COMUN
+// FIECARE FIR ARE O ARENA DE MEMORIE PROPRIE, REFOLOSITA DE LA O SIMULARE LA ALTA, ASA CA MEMORIA UNEI LUMI E ATINSA DOAR DE FIRUL EI
+class BatchRunner
+{
+public:
+
+	// threadCount = 0 FOLOSESTE TOATE NUCLEELE
+	BatchReport Run(const BatchScenario& scenario, int simulationCount, int threadCount = 0)
+	{
+		BatchReport report;
+
+		if (simulationCount < 0)
+		{
+			std::cout << "ERROR :: BATCH RUNNER :: RUN :: THE NUMBER OF SIMULATIONS CANNOT BE NEGATIVE\n";
+
+			return report;
+		}
+
+		if (threadCount <= 0)
+		{
+			threadCount = std::max(1, (int)std::thread::hardware_concurrency());
+		}
+		threadCount = std::max(1, std::min(threadCount, simulationCount));
+
+		report.simulationCount = simulationCount;
+		report.threadCount = threadCount;
+		report.results.resize(simulationCount);
+
+		std::atomic<int> nextSimulation(0);
+		std::mutex reportMutex;
+
+		std::chrono::steady_clock::time_point batchStart = std::chrono::steady_clock::now();
+
+		std::vector<std::thread> threads;
+
+		for (int i = 0; i < threadCount; i++)
+		{
+			threads.emplace_back([this, &scenario, &report, &nextSimulation, &reportMutex, simulationCount, i]()
+				{
+					MemoryArena arena(this->arenaBlockSize);
+
+					PerformanceCounters::Get()->Reset();
+
+					for (int simulationIndex = nextSimulation++; simulationIndex < simulationCount; simulationIndex = nextSimulation++)
+					{
+						arena.Reset();
+
+						report.results[simulationIndex] = this->RunSimulation(scenario, simulationIndex, arena);
+						report.results[simulationIndex].threadIndex = i;
+					}
+
+					if (PerformanceCounters::IsEnabled())
+					{
+						std::lock_guard<std::mutex> lock(reportMutex);
+						report.hardwareCounters.Merge(PerformanceCounters::Get()->GetReport());
+					}
+				});
+		}
+
+		for (int i = 0; i < threads.size(); i++)
+		{
+			threads[i].join();
+		}
+
+		report.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - batchStart).count();
+
+		this->Aggregate(report);
+
+		return report;
+	}
+
+	// CAT DE MARI SUNT BLOCURILE ARENELOR FIRELOR
+	void SetArenaBlockSize(std::size_t arenaBlockSize)
+	{
+		this->arenaBlockSize = arenaBlockSize;
+	}
+
+	void PrintReport(const BatchReport& report)
+	{
+		std::cout << "BATCH :: SIMULATIONS " << report.simulationCount << " :: THREADS " << report.threadCount << " :: WALL TIME " << report.wallTime << " S\n";
+		std::cout << "BATCH :: FRAMES " << report.totalFrames << " :: SIMULATED " << report.totalSimulatedTime << " S :: " << report.framesPerSecond << " FRAMES/S :: " << report.simulationsPerSecond << " SIMULATIONS/S\n";
+		std::cout << "BATCH :: SIMULATION TIME (MS) :: AVG " << report.averageSimulationTime << " :: MAX " << report.maxSimulationTime << " :: DISTINCT CHECKSUMS " << report.distinctChecksums << "\n";
+
+		if (report.failedSimulations > 0)
+		{
+			std::cout << "BATCH :: FAILED SIMULATIONS " << report.failedSimulations << "\n";
+
+			for (int i = 0; i < report.results.size(); i++)
+			{
+				if (!report.results[i].error.empty())
+				{
+					std::cout << "BATCH :: SIMULATION " << i << " :: " << report.results[i].error << "\n";
+				}
+			}
+		}
+
+		for (int i = 0; i < report.averageValues.size(); i++)
+		{
+			std::cout << "BATCH :: VALUE " << i << " :: AVG " << report.averageValues[i] << "\n";
+		}
+
+		if (PerformanceCounters::IsEnabled())
+		{
+			PerformanceCounters::PrintReport(report.hardwareCounters);
+		}
+	}
+
+private:
+
+	std::size_t arenaBlockSize = 1 << 20;
+
+	BatchSimulationResult RunSimulation(const BatchScenario& scenario, int simulationIndex, MemoryArena& arena)
+	{
+		BatchSimulationResult result;
+		result.simulationIndex = simulationIndex;
+
+		std::chrono::steady_clock::time_point simulationStart = std::chrono::steady_clock::now();
+
+		ScriptedInputSource inputSource;
+
+		for (int i = 0; i < scenario.inputScript.size(); i++)
+		{
+			inputSource.AddEvent(scenario.inputScript[i].timestamp, scenario.inputScript[i].key, scenario.inputScript[i].pressed);
+		}
+
+		World* world = new World(&arena);
+
+		{
+			WorldScope scope(world);
+
+			TimeManager::Get()->SetCurrentTime(0.0);
+			UserInputManager::Get()->SetInputSource(&inputSource);
+
+			if (scenario.deterministic)
+			{
+				ArtificialIntelligenceManager::Get()->SetFrameBudget(0.0);
+			}
+
+			// O SIMULARE ESUATA NU OPRESTE FIRUL SI NICI LOTUL: EROAREA AJUNGE IN REZULTAT, IAR LUMEA E STEARSA CA DE OBICEI
+			try
+			{
+				if (scenario.buildLevel)
+				{
+					scenario.buildLevel(simulationIndex);
+				}
+
+				for (int frame = 0; frame < scenario.frameCount; frame++)
+				{
+					TimeManager::Get()->SetDeltaTime(scenario.deltaTime);
+
+					GameEngine::Get()->UpdateSystems();
+
+					FrameAllocator::Get()->Reset();
+
+					result.frameCount++;
+					result.simulatedTime += scenario.deltaTime;
+
+					if (UserInputManager::Get()->ShouldGameEngineStop() || (scenario.shouldStop && scenario.shouldStop(simulationIndex)))
+					{
+						break;
+					}
+				}
+
+				result.checksum = ReplayManager::Get()->ComputeSimulationChecksum();
+
+				if (scenario.collectValues)
+				{
+					scenario.collectValues(simulationIndex, result.values);
+				}
+			}
+			catch (const std::exception& exception)
+			{
+				result.error = exception.what();
+			}
+			catch (...)
+			{
+				result.error = "UNKNOWN EXCEPTION";
+			}
+
+			if (!result.error.empty())
+			{
+				FrameAllocator::Get()->Reset();
+			}
+		}
+
+		delete world;
+
+		result.arenaBytes = arena.GetUsedBytes();
+		result.wallTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - simulationStart).count();
+
+		return result;
+	}
+
+	void Aggregate(BatchReport& report)
+	{
+		std::vector<std::uint64_t> checksums;
+
+		for (int i = 0; i < report.results.size(); i++)
+		{
+			const BatchSimulationResult& result = report.results[i];
+
+			if (!result.error.empty())
+			{
+				report.failedSimulations++;
+
+				continue;
+			}
+
+			report.totalFrames += result.frameCount;
+			report.totalSimulatedTime += result.simulatedTime;
+
+			report.averageSimulationTime += result.wallTime;
+			report.maxSimulationTime = std::max(report.maxSimulationTime, result.wallTime);
+
+			checksums.push_back(result.checksum);
+
+			if (report.averageValues.size() < result.values.size())
+			{
+				report.averageValues.resize(result.values.size(), 0.0);
+			}
+			for (int j = 0; j < result.values.size(); j++)
+			{
+				report.averageValues[j] += result.values[j];
+			}
+		}
+
+		int succeededSimulations = (int)report.results.size() - report.failedSimulations;
+
+		if (succeededSimulations > 0)
+		{
+			report.averageSimulationTime /= succeededSimulations;
+
+			for (int j = 0; j < report.averageValues.size(); j++)
+			{
+				report.averageValues[j] /= succeededSimulations;
+			}
+		}
+
+		std::sort(checksums.begin(), checksums.end());
+		report.distinctChecksums = (int)(std::unique(checksums.begin(), checksums.end()) - checksums.begin());
+
+		if (report.wallTime > 0.0)
+		{
+			report.framesPerSecond = report.totalFrames / report.wallTime;
+			report.simulationsPerSecond = report.simulationCount / report.wallTime;
+		}
+	}
+};
\ No newline at end of file